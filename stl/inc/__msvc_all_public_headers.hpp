@@ -86,6 +86,8 @@
 #include <deque>
 #include <exception>
 #include <filesystem>
+#include <flat_hash_map>
+#include <flat_hash_set>
 #include <forward_list>
 #include <fstream>
 #include <functional>
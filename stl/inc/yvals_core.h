@@ -644,6 +644,36 @@
 #define _STL_OPTIMIZE_SYSTEM_ERROR_OPERATORS 1
 #endif // _STL_OPTIMIZE_SYSTEM_ERROR_OPERATORS
 
+// Controls whether the parallel algorithms report each region they run on the thread pool, and each time they can't
+// get the resources to start one, to the callback installed with stdext::execution::set_parallel_region_callback
+#ifndef _STL_INSTRUMENT_PARALLEL_ALGORITHMS
+#define _STL_INSTRUMENT_PARALLEL_ALGORITHMS 0
+#endif // _STL_INSTRUMENT_PARALLEL_ALGORITHMS
+
+// Controls whether pmr::synchronized_pool_resource serves small blocks from caches sharded by thread, instead of
+// taking one mutex for every allocation and deallocation
+#ifndef _STL_SHARDED_SYNCHRONIZED_POOL_RESOURCE
+#define _STL_SHARDED_SYNCHRONIZED_POOL_RESOURCE 0
+#endif // _STL_SHARDED_SYNCHRONIZED_POOL_RESOURCE
+
+// Controls whether pmr pool resources find their pools in a table indexed by the log of the block size, instead of
+// searching a vector of pools sorted by block size
+#ifndef _STL_POOL_RESOURCE_POOL_TABLE
+#define _STL_POOL_RESOURCE_POOL_TABLE 0
+#endif // _STL_POOL_RESOURCE_POOL_TABLE
+
+// When _STL_POOL_RESOURCE_POOL_TABLE is enabled, controls whether pmr pool resources create the pools for every block
+// size on their first pooled allocation, instead of creating each pool when a block of its size is first requested
+#ifndef _STL_POOL_RESOURCE_EAGER_POOLS
+#define _STL_POOL_RESOURCE_EAGER_POOLS 0
+#endif // _STL_POOL_RESOURCE_EAGER_POOLS
+
+// Controls whether the unordered containers grow by splitting one bucket at a time when an insertion exceeds
+// max_load_factor(), instead of redistributing every element into a new power of 2 bucket count
+#ifndef _STL_INCREMENTAL_UNORDERED_REHASH
+#define _STL_INCREMENTAL_UNORDERED_REHASH 0
+#endif // _STL_INCREMENTAL_UNORDERED_REHASH
+
 #if _HAS_IF_CONSTEXPR
 #define _CONSTEXPR_IF constexpr
 #else // _HAS_IF_CONSTEXPR
@@ -47,6 +47,833 @@ static void _Advance_bytes(const void*& _Target, ptrdiff_t _Offset) noexcept {
     _Target = static_cast<const unsigned char*>(_Target) + _Offset;
 }
 
+struct _Min_max_element_t {
+    const void* _Min;
+    const void* _Max;
+};
+
+struct _Find_traits_1 {
+    static __m256i _Set_avx(const unsigned char _Val) noexcept {
+        return _mm256_set1_epi8(static_cast<char>(_Val));
+    }
+
+    static __m128i _Set_sse(const unsigned char _Val) noexcept {
+        return _mm_set1_epi8(static_cast<char>(_Val));
+    }
+
+    static __m256i _Cmp_avx(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+        return _mm256_cmpeq_epi8(_Lhs, _Rhs);
+    }
+
+    static __m128i _Cmp_sse(const __m128i _Lhs, const __m128i _Rhs) noexcept {
+        return _mm_cmpeq_epi8(_Lhs, _Rhs);
+    }
+};
+
+struct _Find_traits_2 {
+    static __m256i _Set_avx(const unsigned short _Val) noexcept {
+        return _mm256_set1_epi16(static_cast<short>(_Val));
+    }
+
+    static __m128i _Set_sse(const unsigned short _Val) noexcept {
+        return _mm_set1_epi16(static_cast<short>(_Val));
+    }
+
+    static __m256i _Cmp_avx(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+        return _mm256_cmpeq_epi16(_Lhs, _Rhs);
+    }
+
+    static __m128i _Cmp_sse(const __m128i _Lhs, const __m128i _Rhs) noexcept {
+        return _mm_cmpeq_epi16(_Lhs, _Rhs);
+    }
+};
+
+struct _Find_traits_4 {
+    static __m256i _Set_avx(const unsigned long _Val) noexcept {
+        return _mm256_set1_epi32(static_cast<int>(_Val));
+    }
+
+    static __m128i _Set_sse(const unsigned long _Val) noexcept {
+        return _mm_set1_epi32(static_cast<int>(_Val));
+    }
+
+    static __m256i _Cmp_avx(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+        return _mm256_cmpeq_epi32(_Lhs, _Rhs);
+    }
+
+    static __m128i _Cmp_sse(const __m128i _Lhs, const __m128i _Rhs) noexcept {
+        return _mm_cmpeq_epi32(_Lhs, _Rhs);
+    }
+};
+
+struct _Find_traits_8 {
+    static __m256i _Set_avx(const unsigned long long _Val) noexcept {
+        return _mm256_set1_epi64x(static_cast<long long>(_Val));
+    }
+
+    static __m128i _Set_sse(const unsigned long long _Val) noexcept {
+        return _mm_set1_epi64x(static_cast<long long>(_Val));
+    }
+
+    static __m256i _Cmp_avx(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+        return _mm256_cmpeq_epi64(_Lhs, _Rhs);
+    }
+
+    static __m128i _Cmp_sse(const __m128i _Lhs, const __m128i _Rhs) noexcept {
+        return _mm_cmpeq_epi64(_Lhs, _Rhs); // SSE4.1
+    }
+};
+
+// The vector loops below compare whole blocks and turn the results into byte masks; each matching element sets
+// sizeof(_Ty) consecutive bits, so the lowest set bit is the byte offset of the first match and the population count
+// is sizeof(_Ty) times the number of matches.
+
+template <class _Traits, class _Ty>
+static const void* _Find_trivial(const void* _First, const void* const _Last, const _Ty _Val) noexcept {
+    if (_Byte_length(_First, _Last) >= 32 && _bittest(&__isa_enabled, __ISA_AVAILABLE_AVX2)) {
+        const __m256i _Comparand = _Traits::_Set_avx(_Val);
+        const void* _Stop_at     = _First;
+        _Advance_bytes(_Stop_at, _Byte_length(_First, _Last) >> 5 << 5);
+        do {
+            const __m256i _Data = _mm256_loadu_si256(static_cast<const __m256i*>(_First));
+            const int _Bingo    = _mm256_movemask_epi8(_Traits::_Cmp_avx(_Data, _Comparand));
+            if (_Bingo != 0) {
+                unsigned long _Offset;
+                _BitScanForward(&_Offset, static_cast<unsigned long>(_Bingo));
+                _Advance_bytes(_First, static_cast<ptrdiff_t>(_Offset));
+                return _First;
+            }
+
+            _Advance_bytes(_First, 32);
+        } while (_First != _Stop_at);
+    }
+
+    if (_Byte_length(_First, _Last) >= 16 && _bittest(&__isa_enabled, __ISA_AVAILABLE_SSE42)) {
+        const __m128i _Comparand = _Traits::_Set_sse(_Val);
+        const void* _Stop_at     = _First;
+        _Advance_bytes(_Stop_at, _Byte_length(_First, _Last) >> 4 << 4);
+        do {
+            const __m128i _Data = _mm_loadu_si128(static_cast<const __m128i*>(_First));
+            const int _Bingo    = _mm_movemask_epi8(_Traits::_Cmp_sse(_Data, _Comparand));
+            if (_Bingo != 0) {
+                unsigned long _Offset;
+                _BitScanForward(&_Offset, static_cast<unsigned long>(_Bingo));
+                _Advance_bytes(_First, static_cast<ptrdiff_t>(_Offset));
+                return _First;
+            }
+
+            _Advance_bytes(_First, 16);
+        } while (_First != _Stop_at);
+    }
+
+    auto _Ptr = static_cast<const _Ty*>(_First);
+    for (; _Ptr != _Last && *_Ptr != _Val; ++_Ptr) {
+    }
+
+    return _Ptr;
+}
+
+template <class _Traits, class _Ty>
+static size_t _Count_trivial(const void* _First, const void* const _Last, const _Ty _Val) noexcept {
+    size_t _Matched_bytes = 0;
+    if (_Byte_length(_First, _Last) >= 32 && _bittest(&__isa_enabled, __ISA_AVAILABLE_AVX2)) {
+        const __m256i _Comparand = _Traits::_Set_avx(_Val);
+        const void* _Stop_at     = _First;
+        _Advance_bytes(_Stop_at, _Byte_length(_First, _Last) >> 5 << 5);
+        do {
+            const __m256i _Data = _mm256_loadu_si256(static_cast<const __m256i*>(_First));
+            const int _Bingo    = _mm256_movemask_epi8(_Traits::_Cmp_avx(_Data, _Comparand));
+            _Matched_bytes += _mm_popcnt_u32(static_cast<unsigned int>(_Bingo));
+            _Advance_bytes(_First, 32);
+        } while (_First != _Stop_at);
+    }
+
+    if (_Byte_length(_First, _Last) >= 16 && _bittest(&__isa_enabled, __ISA_AVAILABLE_SSE42)) {
+        const __m128i _Comparand = _Traits::_Set_sse(_Val);
+        const void* _Stop_at     = _First;
+        _Advance_bytes(_Stop_at, _Byte_length(_First, _Last) >> 4 << 4);
+        do {
+            const __m128i _Data = _mm_loadu_si128(static_cast<const __m128i*>(_First));
+            const int _Bingo    = _mm_movemask_epi8(_Traits::_Cmp_sse(_Data, _Comparand));
+            _Matched_bytes += _mm_popcnt_u32(static_cast<unsigned int>(_Bingo)); // SSE4.2
+            _Advance_bytes(_First, 16);
+        } while (_First != _Stop_at);
+    }
+
+    size_t _Result = _Matched_bytes / sizeof(_Ty);
+    for (auto _Ptr = static_cast<const _Ty*>(_First); _Ptr != _Last; ++_Ptr) {
+        if (*_Ptr == _Val) {
+            ++_Result;
+        }
+    }
+
+    return _Result;
+}
+
+template <class _Traits, class _Ty>
+static const void* _Find_last_trivial(const void* const _First, const void* _Last, const _Ty _Val) noexcept {
+    // returns _First when no element matches and _First does not match either; callers know that a match exists
+    if (_Byte_length(_First, _Last) >= 32 && _bittest(&__isa_enabled, __ISA_AVAILABLE_AVX2)) {
+        const __m256i _Comparand = _Traits::_Set_avx(_Val);
+        const void* _Stop_at     = _Last;
+        _Advance_bytes(_Stop_at, -static_cast<ptrdiff_t>(_Byte_length(_First, _Last) >> 5 << 5));
+        do {
+            _Advance_bytes(_Last, -32);
+            const __m256i _Data = _mm256_loadu_si256(static_cast<const __m256i*>(_Last));
+            const int _Bingo    = _mm256_movemask_epi8(_Traits::_Cmp_avx(_Data, _Comparand));
+            if (_Bingo != 0) {
+                unsigned long _Offset;
+                _BitScanReverse(&_Offset, static_cast<unsigned long>(_Bingo));
+                _Advance_bytes(_Last, static_cast<ptrdiff_t>(_Offset) - static_cast<ptrdiff_t>(sizeof(_Ty) - 1));
+                return _Last;
+            }
+        } while (_Last != _Stop_at);
+    }
+
+    if (_Byte_length(_First, _Last) >= 16 && _bittest(&__isa_enabled, __ISA_AVAILABLE_SSE42)) {
+        const __m128i _Comparand = _Traits::_Set_sse(_Val);
+        const void* _Stop_at     = _Last;
+        _Advance_bytes(_Stop_at, -static_cast<ptrdiff_t>(_Byte_length(_First, _Last) >> 4 << 4));
+        do {
+            _Advance_bytes(_Last, -16);
+            const __m128i _Data = _mm_loadu_si128(static_cast<const __m128i*>(_Last));
+            const int _Bingo    = _mm_movemask_epi8(_Traits::_Cmp_sse(_Data, _Comparand));
+            if (_Bingo != 0) {
+                unsigned long _Offset;
+                _BitScanReverse(&_Offset, static_cast<unsigned long>(_Bingo));
+                _Advance_bytes(_Last, static_cast<ptrdiff_t>(_Offset) - static_cast<ptrdiff_t>(sizeof(_Ty) - 1));
+                return _Last;
+            }
+        } while (_Last != _Stop_at);
+    }
+
+    auto _Ptr = static_cast<const _Ty*>(_Last);
+    while (_Ptr != _First && *--_Ptr != _Val) {
+    }
+
+    return _Ptr;
+}
+
+// min_element, max_element, and minmax_element first reduce the range to its extreme values with vertical min/max
+// instructions, then locate the first (or, for the maximum of minmax_element, the last) element equal to them.
+// Floating-point elements are required to not be NaN, as with the scalar algorithms using operator<.
+
+struct _Minmax_traits_1s : _Find_traits_1 {
+    using _Ty         = signed char;
+    using _Find_value = unsigned char;
+
+    static __m256i _Min_avx(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+        return _mm256_min_epi8(_Lhs, _Rhs);
+    }
+
+    static __m256i _Max_avx(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+        return _mm256_max_epi8(_Lhs, _Rhs);
+    }
+
+    static __m128i _Min_sse(const __m128i _Lhs, const __m128i _Rhs) noexcept {
+        return _mm_min_epi8(_Lhs, _Rhs); // SSE4.1
+    }
+
+    static __m128i _Max_sse(const __m128i _Lhs, const __m128i _Rhs) noexcept {
+        return _mm_max_epi8(_Lhs, _Rhs); // SSE4.1
+    }
+};
+
+struct _Minmax_traits_1u : _Find_traits_1 {
+    using _Ty         = unsigned char;
+    using _Find_value = unsigned char;
+
+    static __m256i _Min_avx(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+        return _mm256_min_epu8(_Lhs, _Rhs);
+    }
+
+    static __m256i _Max_avx(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+        return _mm256_max_epu8(_Lhs, _Rhs);
+    }
+
+    static __m128i _Min_sse(const __m128i _Lhs, const __m128i _Rhs) noexcept {
+        return _mm_min_epu8(_Lhs, _Rhs);
+    }
+
+    static __m128i _Max_sse(const __m128i _Lhs, const __m128i _Rhs) noexcept {
+        return _mm_max_epu8(_Lhs, _Rhs);
+    }
+};
+
+struct _Minmax_traits_2s : _Find_traits_2 {
+    using _Ty         = short;
+    using _Find_value = unsigned short;
+
+    static __m256i _Min_avx(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+        return _mm256_min_epi16(_Lhs, _Rhs);
+    }
+
+    static __m256i _Max_avx(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+        return _mm256_max_epi16(_Lhs, _Rhs);
+    }
+
+    static __m128i _Min_sse(const __m128i _Lhs, const __m128i _Rhs) noexcept {
+        return _mm_min_epi16(_Lhs, _Rhs);
+    }
+
+    static __m128i _Max_sse(const __m128i _Lhs, const __m128i _Rhs) noexcept {
+        return _mm_max_epi16(_Lhs, _Rhs);
+    }
+};
+
+struct _Minmax_traits_2u : _Find_traits_2 {
+    using _Ty         = unsigned short;
+    using _Find_value = unsigned short;
+
+    static __m256i _Min_avx(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+        return _mm256_min_epu16(_Lhs, _Rhs);
+    }
+
+    static __m256i _Max_avx(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+        return _mm256_max_epu16(_Lhs, _Rhs);
+    }
+
+    static __m128i _Min_sse(const __m128i _Lhs, const __m128i _Rhs) noexcept {
+        return _mm_min_epu16(_Lhs, _Rhs); // SSE4.1
+    }
+
+    static __m128i _Max_sse(const __m128i _Lhs, const __m128i _Rhs) noexcept {
+        return _mm_max_epu16(_Lhs, _Rhs); // SSE4.1
+    }
+};
+
+struct _Minmax_traits_4s : _Find_traits_4 {
+    using _Ty         = long;
+    using _Find_value = unsigned long;
+
+    static __m256i _Min_avx(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+        return _mm256_min_epi32(_Lhs, _Rhs);
+    }
+
+    static __m256i _Max_avx(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+        return _mm256_max_epi32(_Lhs, _Rhs);
+    }
+
+    static __m128i _Min_sse(const __m128i _Lhs, const __m128i _Rhs) noexcept {
+        return _mm_min_epi32(_Lhs, _Rhs); // SSE4.1
+    }
+
+    static __m128i _Max_sse(const __m128i _Lhs, const __m128i _Rhs) noexcept {
+        return _mm_max_epi32(_Lhs, _Rhs); // SSE4.1
+    }
+};
+
+struct _Minmax_traits_4u : _Find_traits_4 {
+    using _Ty         = unsigned long;
+    using _Find_value = unsigned long;
+
+    static __m256i _Min_avx(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+        return _mm256_min_epu32(_Lhs, _Rhs);
+    }
+
+    static __m256i _Max_avx(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+        return _mm256_max_epu32(_Lhs, _Rhs);
+    }
+
+    static __m128i _Min_sse(const __m128i _Lhs, const __m128i _Rhs) noexcept {
+        return _mm_min_epu32(_Lhs, _Rhs); // SSE4.1
+    }
+
+    static __m128i _Max_sse(const __m128i _Lhs, const __m128i _Rhs) noexcept {
+        return _mm_max_epu32(_Lhs, _Rhs); // SSE4.1
+    }
+};
+
+struct _Minmax_traits_8s : _Find_traits_8 {
+    using _Ty         = long long;
+    using _Find_value = unsigned long long;
+
+    static __m256i _Min_avx(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+        return _mm256_blendv_epi8(_Lhs, _Rhs, _mm256_cmpgt_epi64(_Lhs, _Rhs));
+    }
+
+    static __m256i _Max_avx(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+        return _mm256_blendv_epi8(_Lhs, _Rhs, _mm256_cmpgt_epi64(_Rhs, _Lhs));
+    }
+
+    static __m128i _Min_sse(const __m128i _Lhs, const __m128i _Rhs) noexcept {
+        return _mm_blendv_epi8(_Lhs, _Rhs, _mm_cmpgt_epi64(_Lhs, _Rhs)); // SSE4.2
+    }
+
+    static __m128i _Max_sse(const __m128i _Lhs, const __m128i _Rhs) noexcept {
+        return _mm_blendv_epi8(_Lhs, _Rhs, _mm_cmpgt_epi64(_Rhs, _Lhs)); // SSE4.2
+    }
+};
+
+struct _Minmax_traits_8u : _Find_traits_8 {
+    using _Ty         = unsigned long long;
+    using _Find_value = unsigned long long;
+
+    // there are no unsigned 64-bit comparisons, so flip the sign bits and compare as signed
+
+    static __m256i _Min_avx(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+        const __m256i _Sign = _mm256_set1_epi64x(static_cast<long long>(0x8000'0000'0000'0000ULL));
+        const __m256i _Gt   = _mm256_cmpgt_epi64(_mm256_xor_si256(_Lhs, _Sign), _mm256_xor_si256(_Rhs, _Sign));
+        return _mm256_blendv_epi8(_Lhs, _Rhs, _Gt);
+    }
+
+    static __m256i _Max_avx(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+        const __m256i _Sign = _mm256_set1_epi64x(static_cast<long long>(0x8000'0000'0000'0000ULL));
+        const __m256i _Lt   = _mm256_cmpgt_epi64(_mm256_xor_si256(_Rhs, _Sign), _mm256_xor_si256(_Lhs, _Sign));
+        return _mm256_blendv_epi8(_Lhs, _Rhs, _Lt);
+    }
+
+    static __m128i _Min_sse(const __m128i _Lhs, const __m128i _Rhs) noexcept {
+        const __m128i _Sign = _mm_set1_epi64x(static_cast<long long>(0x8000'0000'0000'0000ULL));
+        const __m128i _Gt   = _mm_cmpgt_epi64(_mm_xor_si128(_Lhs, _Sign), _mm_xor_si128(_Rhs, _Sign)); // SSE4.2
+        return _mm_blendv_epi8(_Lhs, _Rhs, _Gt);
+    }
+
+    static __m128i _Max_sse(const __m128i _Lhs, const __m128i _Rhs) noexcept {
+        const __m128i _Sign = _mm_set1_epi64x(static_cast<long long>(0x8000'0000'0000'0000ULL));
+        const __m128i _Lt   = _mm_cmpgt_epi64(_mm_xor_si128(_Rhs, _Sign), _mm_xor_si128(_Lhs, _Sign)); // SSE4.2
+        return _mm_blendv_epi8(_Lhs, _Rhs, _Lt);
+    }
+};
+
+struct _Minmax_traits_f {
+    using _Ty         = float;
+    using _Find_value = float;
+
+    static __m256i _Set_avx(const float _Val) noexcept {
+        return _mm256_castps_si256(_mm256_set1_ps(_Val));
+    }
+
+    static __m128i _Set_sse(const float _Val) noexcept {
+        return _mm_castps_si128(_mm_set1_ps(_Val));
+    }
+
+    // compares as float, so that -0.0 and +0.0 are equal
+    static __m256i _Cmp_avx(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+        return _mm256_castps_si256(_mm256_cmp_ps(_mm256_castsi256_ps(_Lhs), _mm256_castsi256_ps(_Rhs), _CMP_EQ_OQ));
+    }
+
+    static __m128i _Cmp_sse(const __m128i _Lhs, const __m128i _Rhs) noexcept {
+        return _mm_castps_si128(_mm_cmpeq_ps(_mm_castsi128_ps(_Lhs), _mm_castsi128_ps(_Rhs)));
+    }
+
+    static __m256i _Min_avx(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+        return _mm256_castps_si256(_mm256_min_ps(_mm256_castsi256_ps(_Lhs), _mm256_castsi256_ps(_Rhs)));
+    }
+
+    static __m256i _Max_avx(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+        return _mm256_castps_si256(_mm256_max_ps(_mm256_castsi256_ps(_Lhs), _mm256_castsi256_ps(_Rhs)));
+    }
+
+    static __m128i _Min_sse(const __m128i _Lhs, const __m128i _Rhs) noexcept {
+        return _mm_castps_si128(_mm_min_ps(_mm_castsi128_ps(_Lhs), _mm_castsi128_ps(_Rhs)));
+    }
+
+    static __m128i _Max_sse(const __m128i _Lhs, const __m128i _Rhs) noexcept {
+        return _mm_castps_si128(_mm_max_ps(_mm_castsi128_ps(_Lhs), _mm_castsi128_ps(_Rhs)));
+    }
+};
+
+struct _Minmax_traits_d {
+    using _Ty         = double;
+    using _Find_value = double;
+
+    static __m256i _Set_avx(const double _Val) noexcept {
+        return _mm256_castpd_si256(_mm256_set1_pd(_Val));
+    }
+
+    static __m128i _Set_sse(const double _Val) noexcept {
+        return _mm_castpd_si128(_mm_set1_pd(_Val));
+    }
+
+    // compares as double, so that -0.0 and +0.0 are equal
+    static __m256i _Cmp_avx(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+        return _mm256_castpd_si256(_mm256_cmp_pd(_mm256_castsi256_pd(_Lhs), _mm256_castsi256_pd(_Rhs), _CMP_EQ_OQ));
+    }
+
+    static __m128i _Cmp_sse(const __m128i _Lhs, const __m128i _Rhs) noexcept {
+        return _mm_castpd_si128(_mm_cmpeq_pd(_mm_castsi128_pd(_Lhs), _mm_castsi128_pd(_Rhs)));
+    }
+
+    static __m256i _Min_avx(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+        return _mm256_castpd_si256(_mm256_min_pd(_mm256_castsi256_pd(_Lhs), _mm256_castsi256_pd(_Rhs)));
+    }
+
+    static __m256i _Max_avx(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+        return _mm256_castpd_si256(_mm256_max_pd(_mm256_castsi256_pd(_Lhs), _mm256_castsi256_pd(_Rhs)));
+    }
+
+    static __m128i _Min_sse(const __m128i _Lhs, const __m128i _Rhs) noexcept {
+        return _mm_castpd_si128(_mm_min_pd(_mm_castsi128_pd(_Lhs), _mm_castsi128_pd(_Rhs)));
+    }
+
+    static __m128i _Max_sse(const __m128i _Lhs, const __m128i _Rhs) noexcept {
+        return _mm_castpd_si128(_mm_max_pd(_mm_castsi128_pd(_Lhs), _mm_castsi128_pd(_Rhs)));
+    }
+};
+
+enum _Min_max_mode {
+    _Mode_min  = 1 << 0,
+    _Mode_max  = 1 << 1,
+    _Mode_both = _Mode_min | _Mode_max,
+};
+
+template <_Min_max_mode _Mode, class _Traits, class _Ty = typename _Traits::_Ty>
+static void _Reduce_lanes(const __m256i _Mins, const __m256i _Maxs, _Ty& _Min_val, _Ty& _Max_val) noexcept {
+    _Ty _Lanes[32 / sizeof(_Ty)];
+    if constexpr ((_Mode & _Mode_min) != 0) {
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(_Lanes), _Mins);
+        for (const _Ty _Lane : _Lanes) {
+            if (_Lane < _Min_val) {
+                _Min_val = _Lane;
+            }
+        }
+    }
+
+    if constexpr ((_Mode & _Mode_max) != 0) {
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(_Lanes), _Maxs);
+        for (const _Ty _Lane : _Lanes) {
+            if (_Max_val < _Lane) {
+                _Max_val = _Lane;
+            }
+        }
+    }
+}
+
+template <_Min_max_mode _Mode, class _Traits, class _Ty = typename _Traits::_Ty>
+static void _Reduce_lanes(const __m128i _Mins, const __m128i _Maxs, _Ty& _Min_val, _Ty& _Max_val) noexcept {
+    _Ty _Lanes[16 / sizeof(_Ty)];
+    if constexpr ((_Mode & _Mode_min) != 0) {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(_Lanes), _Mins);
+        for (const _Ty _Lane : _Lanes) {
+            if (_Lane < _Min_val) {
+                _Min_val = _Lane;
+            }
+        }
+    }
+
+    if constexpr ((_Mode & _Mode_max) != 0) {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(_Lanes), _Maxs);
+        for (const _Ty _Lane : _Lanes) {
+            if (_Max_val < _Lane) {
+                _Max_val = _Lane;
+            }
+        }
+    }
+}
+
+template <_Min_max_mode _Mode, class _Traits, class _Ty = typename _Traits::_Ty>
+static void _Min_max_values(const void* _First, const void* const _Last, _Ty& _Min_val, _Ty& _Max_val) noexcept {
+    // computes the extreme values of the non-empty range [_First, _Last)
+    _Min_val = *static_cast<const _Ty*>(_First);
+    _Max_val = _Min_val;
+
+    if (_Byte_length(_First, _Last) >= 32 && _bittest(&__isa_enabled, __ISA_AVAILABLE_AVX2)) {
+        const void* _Stop_at = _First;
+        _Advance_bytes(_Stop_at, _Byte_length(_First, _Last) >> 5 << 5);
+        __m256i _Mins = _mm256_loadu_si256(static_cast<const __m256i*>(_First));
+        __m256i _Maxs = _Mins;
+        _Advance_bytes(_First, 32);
+        while (_First != _Stop_at) {
+            const __m256i _Data = _mm256_loadu_si256(static_cast<const __m256i*>(_First));
+            if constexpr ((_Mode & _Mode_min) != 0) {
+                _Mins = _Traits::_Min_avx(_Mins, _Data);
+            }
+
+            if constexpr ((_Mode & _Mode_max) != 0) {
+                _Maxs = _Traits::_Max_avx(_Maxs, _Data);
+            }
+
+            _Advance_bytes(_First, 32);
+        }
+
+        _Reduce_lanes<_Mode, _Traits>(_Mins, _Maxs, _Min_val, _Max_val);
+    }
+
+    if (_Byte_length(_First, _Last) >= 16 && _bittest(&__isa_enabled, __ISA_AVAILABLE_SSE42)) {
+        const void* _Stop_at = _First;
+        _Advance_bytes(_Stop_at, _Byte_length(_First, _Last) >> 4 << 4);
+        __m128i _Mins = _mm_loadu_si128(static_cast<const __m128i*>(_First));
+        __m128i _Maxs = _Mins;
+        _Advance_bytes(_First, 16);
+        while (_First != _Stop_at) {
+            const __m128i _Data = _mm_loadu_si128(static_cast<const __m128i*>(_First));
+            if constexpr ((_Mode & _Mode_min) != 0) {
+                _Mins = _Traits::_Min_sse(_Mins, _Data);
+            }
+
+            if constexpr ((_Mode & _Mode_max) != 0) {
+                _Maxs = _Traits::_Max_sse(_Maxs, _Data);
+            }
+
+            _Advance_bytes(_First, 16);
+        }
+
+        _Reduce_lanes<_Mode, _Traits>(_Mins, _Maxs, _Min_val, _Max_val);
+    }
+
+    for (auto _Ptr = static_cast<const _Ty*>(_First); _Ptr != _Last; ++_Ptr) {
+        if constexpr ((_Mode & _Mode_min) != 0) {
+            if (*_Ptr < _Min_val) {
+                _Min_val = *_Ptr;
+            }
+        }
+
+        if constexpr ((_Mode & _Mode_max) != 0) {
+            if (_Max_val < *_Ptr) {
+                _Max_val = *_Ptr;
+            }
+        }
+    }
+}
+
+template <class _Traits>
+static const void* _Min_element(const void* const _First, const void* const _Last) noexcept {
+    if (_First == _Last) {
+        return _Last;
+    }
+
+    typename _Traits::_Ty _Min_val;
+    typename _Traits::_Ty _Max_val;
+    _Min_max_values<_Mode_min, _Traits>(_First, _Last, _Min_val, _Max_val);
+    return _Find_trivial<_Traits>(_First, _Last, static_cast<typename _Traits::_Find_value>(_Min_val));
+}
+
+template <class _Traits>
+static const void* _Max_element(const void* const _First, const void* const _Last) noexcept {
+    if (_First == _Last) {
+        return _Last;
+    }
+
+    typename _Traits::_Ty _Min_val;
+    typename _Traits::_Ty _Max_val;
+    _Min_max_values<_Mode_max, _Traits>(_First, _Last, _Min_val, _Max_val);
+    return _Find_trivial<_Traits>(_First, _Last, static_cast<typename _Traits::_Find_value>(_Max_val));
+}
+
+template <class _Traits>
+static _Min_max_element_t _Minmax_element(const void* const _First, const void* const _Last) noexcept {
+    if (_First == _Last) {
+        return {_First, _First};
+    }
+
+    typename _Traits::_Ty _Min_val;
+    typename _Traits::_Ty _Max_val;
+    _Min_max_values<_Mode_both, _Traits>(_First, _Last, _Min_val, _Max_val);
+    // like the scalar algorithm, report the first smallest and the last largest element
+    return {_Find_trivial<_Traits>(_First, _Last, static_cast<typename _Traits::_Find_value>(_Min_val)),
+        _Find_last_trivial<_Traits>(_First, _Last, static_cast<typename _Traits::_Find_value>(_Max_val))};
+}
+
+template <class _Ty>
+static __m128i _Load_partial_sse(const _Ty* const _Src, const size_t _Count) noexcept {
+    // loads _Count < 16 / sizeof(_Ty) elements without reading past them, zero-filling the rest of the block
+    _Ty _Buf[16 / sizeof(_Ty)] = {};
+    for (size_t _Idx = 0; _Idx != _Count; ++_Idx) {
+        _Buf[_Idx] = _Src[_Idx];
+    }
+
+    return _mm_loadu_si128(reinterpret_cast<const __m128i*>(_Buf));
+}
+
+// find_first_of and find_last_of compare each block of the haystack against the whole needle, which must fit in one
+// SSE register, with a single pcmpestri; elements outside the explicit lengths never match.
+
+template <class _Ty, int _Ops>
+static const void* _Find_first_of_trivial(const void* const _First1, const void* const _Last1,
+    const void* const _First2, const void* const _Last2) noexcept {
+    auto _Hay              = static_cast<const _Ty*>(_First1);
+    const auto _Hay_end    = static_cast<const _Ty*>(_Last1);
+    const auto _Needle     = static_cast<const _Ty*>(_First2);
+    const auto _Needle_end = static_cast<const _Ty*>(_Last2);
+
+    if (_bittest(&__isa_enabled, __ISA_AVAILABLE_SSE42)) {
+        constexpr size_t _Per_block = 16 / sizeof(_Ty);
+        constexpr int _Block_length = static_cast<int>(_Per_block);
+        constexpr int _Mode         = _Ops | _SIDD_CMP_EQUAL_ANY | _SIDD_LEAST_SIGNIFICANT;
+        const auto _Needle_size     = static_cast<size_t>(_Needle_end - _Needle);
+        const __m128i _Needle_block =
+            _Needle_size == _Per_block ? _mm_loadu_si128(static_cast<const __m128i*>(_First2))
+                                       : _Load_partial_sse(_Needle, _Needle_size);
+        const int _Needle_length = static_cast<int>(_Needle_size);
+
+        for (; static_cast<size_t>(_Hay_end - _Hay) >= _Per_block; _Hay += _Per_block) {
+            const __m128i _Data = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_Hay));
+            const int _Pos      = _mm_cmpestri(_Needle_block, _Needle_length, _Data, _Block_length, _Mode);
+            if (_Pos != _Block_length) {
+                return _Hay + _Pos;
+            }
+        }
+
+        const auto _Rest = static_cast<size_t>(_Hay_end - _Hay);
+        if (_Rest != 0) {
+            const __m128i _Data = _Load_partial_sse(_Hay, _Rest);
+            const int _Pos      = _mm_cmpestri(_Needle_block, _Needle_length, _Data, static_cast<int>(_Rest), _Mode);
+            if (_Pos != _Block_length) {
+                return _Hay + _Pos;
+            }
+        }
+
+        return _Hay_end;
+    }
+
+    for (; _Hay != _Hay_end; ++_Hay) {
+        for (auto _Ptr = _Needle; _Ptr != _Needle_end; ++_Ptr) {
+            if (*_Hay == *_Ptr) {
+                return _Hay;
+            }
+        }
+    }
+
+    return _Hay_end;
+}
+
+template <class _Ty, int _Ops>
+static size_t _Find_last_of_trivial(const void* const _Haystack, size_t _Haystack_length, const void* const _Needle,
+    const size_t _Needle_length) noexcept {
+    const auto _Hay        = static_cast<const _Ty*>(_Haystack);
+    const auto _Needle_ptr = static_cast<const _Ty*>(_Needle);
+
+    if (_bittest(&__isa_enabled, __ISA_AVAILABLE_SSE42)) {
+        constexpr size_t _Per_block = 16 / sizeof(_Ty);
+        constexpr int _Block_length = static_cast<int>(_Per_block);
+        constexpr int _Mode         = _Ops | _SIDD_CMP_EQUAL_ANY | _SIDD_MOST_SIGNIFICANT;
+        const __m128i _Needle_block =
+            _Needle_length == _Per_block ? _mm_loadu_si128(static_cast<const __m128i*>(_Needle))
+                                         : _Load_partial_sse(_Needle_ptr, _Needle_length);
+        const int _Needle_size = static_cast<int>(_Needle_length);
+
+        for (; _Haystack_length >= _Per_block; _Haystack_length -= _Per_block) {
+            const size_t _Block_start = _Haystack_length - _Per_block;
+            const __m128i _Data       = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_Hay + _Block_start));
+            const int _Pos            = _mm_cmpestri(_Needle_block, _Needle_size, _Data, _Block_length, _Mode);
+            if (_Pos != _Block_length) {
+                return _Block_start + static_cast<size_t>(_Pos);
+            }
+        }
+
+        if (_Haystack_length != 0) {
+            const __m128i _Data = _Load_partial_sse(_Hay, _Haystack_length);
+            const int _Pos      = _mm_cmpestri(
+                _Needle_block, _Needle_size, _Data, static_cast<int>(_Haystack_length), _Mode);
+            if (_Pos != _Block_length) {
+                return static_cast<size_t>(_Pos);
+            }
+        }
+
+        return static_cast<size_t>(-1);
+    }
+
+    while (_Haystack_length != 0) {
+        --_Haystack_length;
+        for (size_t _Idx = 0; _Idx != _Needle_length; ++_Idx) {
+            if (_Hay[_Haystack_length] == _Needle_ptr[_Idx]) {
+                return _Haystack_length;
+            }
+        }
+    }
+
+    return static_cast<size_t>(-1);
+}
+
+// search filters candidate positions by comparing the first and the last element of the needle against two
+// overlapping blocks of the haystack at once; only positions where both match are compared in full. This keeps
+// haystacks with many occurrences of the first element, like runs of spaces, from degrading to a compare per element.
+
+template <class _Ty>
+static bool _Equal_middle(const _Ty* const _Candidate, const _Ty* const _Needle, const size_t _Count) noexcept {
+    // the first and the last elements are already known to match
+    for (size_t _Idx = 1; _Idx + 1 < _Count; ++_Idx) {
+        if (_Candidate[_Idx] != _Needle[_Idx]) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+template <class _Traits, class _Ty>
+static const void* _Search_trivial(
+    const void* const _First1, const void* const _Last1, const void* const _First2, const size_t _Count2) noexcept {
+    const auto _Hay        = static_cast<const _Ty*>(_First1);
+    const auto _Needle     = static_cast<const _Ty*>(_First2);
+    const auto _Hay_length = static_cast<size_t>(static_cast<const _Ty*>(_Last1) - _Hay);
+    if (_Count2 == 0) {
+        return _First1;
+    }
+
+    if (_Count2 > _Hay_length) {
+        return _Last1;
+    }
+
+    const size_t _Back_offset = _Count2 - 1;
+    const size_t _Candidates  = _Hay_length - _Back_offset; // number of positions where a match could start
+    const _Ty _Front          = _Needle[0];
+    const _Ty _Back           = _Needle[_Back_offset];
+    size_t _Pos               = 0;
+
+    constexpr size_t _Per_avx = 32 / sizeof(_Ty);
+    if (_Candidates >= _Per_avx && _bittest(&__isa_enabled, __ISA_AVAILABLE_AVX2)) {
+        const __m256i _Front_comparand = _Traits::_Set_avx(_Front);
+        const __m256i _Back_comparand  = _Traits::_Set_avx(_Back);
+        for (; _Candidates - _Pos >= _Per_avx; _Pos += _Per_avx) {
+            const __m256i _Front_data = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_Hay + _Pos));
+            const __m256i _Back_data =
+                _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_Hay + _Pos + _Back_offset));
+            const __m256i _Both = _mm256_and_si256(
+                _Traits::_Cmp_avx(_Front_data, _Front_comparand), _Traits::_Cmp_avx(_Back_data, _Back_comparand));
+            unsigned long _Bingo = static_cast<unsigned long>(_mm256_movemask_epi8(_Both));
+            while (_Bingo != 0) {
+                unsigned long _Offset;
+                _BitScanForward(&_Offset, _Bingo);
+                const auto _Candidate = _Hay + _Pos + _Offset / sizeof(_Ty);
+                if (_Equal_middle(_Candidate, _Needle, _Count2)) {
+                    return _Candidate;
+                }
+
+                _Bingo &= ~(((1UL << sizeof(_Ty)) - 1) << _Offset);
+            }
+        }
+    }
+
+    constexpr size_t _Per_sse = 16 / sizeof(_Ty);
+    if (_Candidates - _Pos >= _Per_sse
+#ifdef _M_IX86
+        && _bittest(&__isa_enabled, __ISA_AVAILABLE_SSE2)
+#endif // _M_IX86
+    ) {
+        const __m128i _Front_comparand = _Traits::_Set_sse(_Front);
+        const __m128i _Back_comparand  = _Traits::_Set_sse(_Back);
+        for (; _Candidates - _Pos >= _Per_sse; _Pos += _Per_sse) {
+            const __m128i _Front_data = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_Hay + _Pos));
+            const __m128i _Back_data  = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_Hay + _Pos + _Back_offset));
+            const __m128i _Both       = _mm_and_si128(
+                _Traits::_Cmp_sse(_Front_data, _Front_comparand), _Traits::_Cmp_sse(_Back_data, _Back_comparand));
+            unsigned long _Bingo = static_cast<unsigned long>(_mm_movemask_epi8(_Both));
+            while (_Bingo != 0) {
+                unsigned long _Offset;
+                _BitScanForward(&_Offset, _Bingo);
+                const auto _Candidate = _Hay + _Pos + _Offset / sizeof(_Ty);
+                if (_Equal_middle(_Candidate, _Needle, _Count2)) {
+                    return _Candidate;
+                }
+
+                _Bingo &= ~(((1UL << sizeof(_Ty)) - 1) << _Offset);
+            }
+        }
+    }
+
+    for (; _Pos != _Candidates; ++_Pos) {
+        const auto _Candidate = _Hay + _Pos;
+        if (_Candidate[0] == _Front && _Candidate[_Back_offset] == _Back
+            && _Equal_middle(_Candidate, _Needle, _Count2)) {
+            return _Candidate;
+        }
+    }
+
+    return _Last1;
+}
+
 extern "C" {
 __declspec(noalias) void __cdecl __std_swap_ranges_trivially_swappable_noalias(
     void* _First1, void* _Last1, void* _First2) noexcept {
@@ -420,6 +1247,206 @@ __declspec(noalias) void __cdecl __std_reverse_copy_trivially_copyable_8(
         static_cast<unsigned long long*>(_Dest));
 }
 
+const void* __cdecl __std_find_trivial_1(const void* _First, const void* _Last, unsigned char _Val) noexcept {
+    return _Find_trivial<_Find_traits_1>(_First, _Last, _Val);
+}
+
+const void* __cdecl __std_find_trivial_2(const void* _First, const void* _Last, unsigned short _Val) noexcept {
+    return _Find_trivial<_Find_traits_2>(_First, _Last, _Val);
+}
+
+const void* __cdecl __std_find_trivial_4(const void* _First, const void* _Last, unsigned long _Val) noexcept {
+    return _Find_trivial<_Find_traits_4>(_First, _Last, _Val);
+}
+
+const void* __cdecl __std_find_trivial_8(const void* _First, const void* _Last, unsigned long long _Val) noexcept {
+    return _Find_trivial<_Find_traits_8>(_First, _Last, _Val);
+}
+
+__declspec(noalias) size_t __cdecl __std_count_trivial_1(
+    const void* _First, const void* _Last, unsigned char _Val) noexcept {
+    return _Count_trivial<_Find_traits_1>(_First, _Last, _Val);
+}
+
+__declspec(noalias) size_t __cdecl __std_count_trivial_2(
+    const void* _First, const void* _Last, unsigned short _Val) noexcept {
+    return _Count_trivial<_Find_traits_2>(_First, _Last, _Val);
+}
+
+__declspec(noalias) size_t __cdecl __std_count_trivial_4(
+    const void* _First, const void* _Last, unsigned long _Val) noexcept {
+    return _Count_trivial<_Find_traits_4>(_First, _Last, _Val);
+}
+
+__declspec(noalias) size_t __cdecl __std_count_trivial_8(
+    const void* _First, const void* _Last, unsigned long long _Val) noexcept {
+    return _Count_trivial<_Find_traits_8>(_First, _Last, _Val);
+}
+
+const void* __cdecl __std_min_element_1(const void* _First, const void* _Last, bool _Signed) noexcept {
+    return _Signed ? _Min_element<_Minmax_traits_1s>(_First, _Last) : _Min_element<_Minmax_traits_1u>(_First, _Last);
+}
+
+const void* __cdecl __std_min_element_2(const void* _First, const void* _Last, bool _Signed) noexcept {
+    return _Signed ? _Min_element<_Minmax_traits_2s>(_First, _Last) : _Min_element<_Minmax_traits_2u>(_First, _Last);
+}
+
+const void* __cdecl __std_min_element_4(const void* _First, const void* _Last, bool _Signed) noexcept {
+    return _Signed ? _Min_element<_Minmax_traits_4s>(_First, _Last) : _Min_element<_Minmax_traits_4u>(_First, _Last);
+}
+
+const void* __cdecl __std_min_element_8(const void* _First, const void* _Last, bool _Signed) noexcept {
+    return _Signed ? _Min_element<_Minmax_traits_8s>(_First, _Last) : _Min_element<_Minmax_traits_8u>(_First, _Last);
+}
+
+const void* __cdecl __std_min_element_f(const void* _First, const void* _Last) noexcept {
+    return _Min_element<_Minmax_traits_f>(_First, _Last);
+}
+
+const void* __cdecl __std_min_element_d(const void* _First, const void* _Last) noexcept {
+    return _Min_element<_Minmax_traits_d>(_First, _Last);
+}
+
+const void* __cdecl __std_max_element_1(const void* _First, const void* _Last, bool _Signed) noexcept {
+    return _Signed ? _Max_element<_Minmax_traits_1s>(_First, _Last) : _Max_element<_Minmax_traits_1u>(_First, _Last);
+}
+
+const void* __cdecl __std_max_element_2(const void* _First, const void* _Last, bool _Signed) noexcept {
+    return _Signed ? _Max_element<_Minmax_traits_2s>(_First, _Last) : _Max_element<_Minmax_traits_2u>(_First, _Last);
+}
+
+const void* __cdecl __std_max_element_4(const void* _First, const void* _Last, bool _Signed) noexcept {
+    return _Signed ? _Max_element<_Minmax_traits_4s>(_First, _Last) : _Max_element<_Minmax_traits_4u>(_First, _Last);
+}
+
+const void* __cdecl __std_max_element_8(const void* _First, const void* _Last, bool _Signed) noexcept {
+    return _Signed ? _Max_element<_Minmax_traits_8s>(_First, _Last) : _Max_element<_Minmax_traits_8u>(_First, _Last);
+}
+
+const void* __cdecl __std_max_element_f(const void* _First, const void* _Last) noexcept {
+    return _Max_element<_Minmax_traits_f>(_First, _Last);
+}
+
+const void* __cdecl __std_max_element_d(const void* _First, const void* _Last) noexcept {
+    return _Max_element<_Minmax_traits_d>(_First, _Last);
+}
+
+_Min_max_element_t __cdecl __std_minmax_element_1(const void* _First, const void* _Last, bool _Signed) noexcept {
+    return _Signed ? _Minmax_element<_Minmax_traits_1s>(_First, _Last)
+                   : _Minmax_element<_Minmax_traits_1u>(_First, _Last);
+}
+
+_Min_max_element_t __cdecl __std_minmax_element_2(const void* _First, const void* _Last, bool _Signed) noexcept {
+    return _Signed ? _Minmax_element<_Minmax_traits_2s>(_First, _Last)
+                   : _Minmax_element<_Minmax_traits_2u>(_First, _Last);
+}
+
+_Min_max_element_t __cdecl __std_minmax_element_4(const void* _First, const void* _Last, bool _Signed) noexcept {
+    return _Signed ? _Minmax_element<_Minmax_traits_4s>(_First, _Last)
+                   : _Minmax_element<_Minmax_traits_4u>(_First, _Last);
+}
+
+_Min_max_element_t __cdecl __std_minmax_element_8(const void* _First, const void* _Last, bool _Signed) noexcept {
+    return _Signed ? _Minmax_element<_Minmax_traits_8s>(_First, _Last)
+                   : _Minmax_element<_Minmax_traits_8u>(_First, _Last);
+}
+
+_Min_max_element_t __cdecl __std_minmax_element_f(const void* _First, const void* _Last) noexcept {
+    return _Minmax_element<_Minmax_traits_f>(_First, _Last);
+}
+
+_Min_max_element_t __cdecl __std_minmax_element_d(const void* _First, const void* _Last) noexcept {
+    return _Minmax_element<_Minmax_traits_d>(_First, _Last);
+}
+
+const void* __cdecl __std_find_first_of_trivial_1(
+    const void* _First1, const void* _Last1, const void* _First2, const void* _Last2) noexcept {
+    return _Find_first_of_trivial<unsigned char, _SIDD_UBYTE_OPS>(_First1, _Last1, _First2, _Last2);
+}
+
+const void* __cdecl __std_find_first_of_trivial_2(
+    const void* _First1, const void* _Last1, const void* _First2, const void* _Last2) noexcept {
+    return _Find_first_of_trivial<unsigned short, _SIDD_UWORD_OPS>(_First1, _Last1, _First2, _Last2);
+}
+
+__declspec(noalias) size_t __cdecl __std_find_last_of_trivial_1(
+    const void* _Haystack, size_t _Haystack_length, const void* _Needle, size_t _Needle_length) noexcept {
+    return _Find_last_of_trivial<unsigned char, _SIDD_UBYTE_OPS>(_Haystack, _Haystack_length, _Needle, _Needle_length);
+}
+
+__declspec(noalias) size_t __cdecl __std_find_last_of_trivial_2(
+    const void* _Haystack, size_t _Haystack_length, const void* _Needle, size_t _Needle_length) noexcept {
+    return _Find_last_of_trivial<unsigned short, _SIDD_UWORD_OPS>(
+        _Haystack, _Haystack_length, _Needle, _Needle_length);
+}
+
+const void* __cdecl __std_search_trivial_1(
+    const void* _First1, const void* _Last1, const void* _First2, size_t _Count2) noexcept {
+    return _Search_trivial<_Find_traits_1, unsigned char>(_First1, _Last1, _First2, _Count2);
+}
+
+const void* __cdecl __std_search_trivial_2(
+    const void* _First1, const void* _Last1, const void* _First2, size_t _Count2) noexcept {
+    return _Search_trivial<_Find_traits_2, unsigned short>(_First1, _Last1, _First2, _Count2);
+}
+
+__declspec(noalias) void __cdecl __std_copy_nontemporal(void* _Dest, const void* _First, const void* _Last) noexcept {
+    // copy [_First, _Last) to [_Dest, ...) with streaming stores, which bypass the cache for the destination
+    auto _Dest_ch       = static_cast<unsigned char*>(_Dest);
+    auto _First_ch      = static_cast<const unsigned char*>(_First);
+    const auto _Last_ch = static_cast<const unsigned char*>(_Last);
+#ifdef _M_IX86
+    if (_Byte_length(_First, _Last) >= 64 && _bittest(&__isa_enabled, __ISA_AVAILABLE_SSE2))
+#else // ^^^ x86 / x64 vvv
+    if (_Byte_length(_First, _Last) >= 64)
+#endif // ^^^ x64 ^^^
+    {
+        for (; (reinterpret_cast<size_t>(_Dest_ch) & 15) != 0; ++_Dest_ch, ++_First_ch) {
+            *_Dest_ch = *_First_ch;
+        }
+
+        const auto _Stop_at = _First_ch + (_Byte_length(_First_ch, _Last_ch) >> 4 << 4);
+        for (; _First_ch != _Stop_at; _First_ch += 16, _Dest_ch += 16) {
+            const __m128i _Data = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_First_ch));
+            _mm_stream_si128(reinterpret_cast<__m128i*>(_Dest_ch), _Data);
+        }
+
+        _mm_sfence(); // streaming stores are weakly ordered
+    }
+
+    for (; _First_ch != _Last_ch; ++_First_ch, ++_Dest_ch) {
+        *_Dest_ch = *_First_ch;
+    }
+}
+
+__declspec(noalias) void __cdecl __std_fill_nontemporal(void* _First, void* _Last, const void* _Pattern) noexcept {
+    // fill [_First, _Last) with streaming stores; the byte at address A receives _Pattern[A % 16]
+    auto _First_ch         = static_cast<unsigned char*>(_First);
+    const auto _Last_ch    = static_cast<unsigned char*>(_Last);
+    const auto _Pattern_ch = static_cast<const unsigned char*>(_Pattern);
+#ifdef _M_IX86
+    if (_Byte_length(_First, _Last) >= 64 && _bittest(&__isa_enabled, __ISA_AVAILABLE_SSE2))
+#else // ^^^ x86 / x64 vvv
+    if (_Byte_length(_First, _Last) >= 64)
+#endif // ^^^ x64 ^^^
+    {
+        for (; (reinterpret_cast<size_t>(_First_ch) & 15) != 0; ++_First_ch) {
+            *_First_ch = _Pattern_ch[reinterpret_cast<size_t>(_First_ch) & 15];
+        }
+
+        const __m128i _Data = _mm_loadu_si128(static_cast<const __m128i*>(_Pattern));
+        const auto _Stop_at = _First_ch + (_Byte_length(_First_ch, _Last_ch) >> 4 << 4);
+        for (; _First_ch != _Stop_at; _First_ch += 16) {
+            _mm_stream_si128(reinterpret_cast<__m128i*>(_First_ch), _Data);
+        }
+
+        _mm_sfence(); // streaming stores are weakly ordered
+    }
+
+    for (; _First_ch != _Last_ch; ++_First_ch) {
+        *_First_ch = _Pattern_ch[reinterpret_cast<size_t>(_First_ch) & 15];
+    }
+}
 
 } // extern "C"
 
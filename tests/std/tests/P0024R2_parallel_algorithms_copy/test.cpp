@@ -0,0 +1,153 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <assert.h>
+#include <cstddef>
+#include <execution>
+#include <list>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace std::execution;
+
+// sizes on both sides of the point where copy and fill go parallel (1 MiB of elements)
+const size_t testSizes[] = {0, 1, 2, 3, 4, 1000, 262'143, 262'144, 262'145, 1'000'001};
+
+// starting points that put the ranges at different alignments relative to pages and 16-byte lines
+const size_t testOffsets[] = {0, 1, 3};
+
+template <class SourceContainer, class DestContainer, class ExecutionPolicy>
+void test_case_copy_parallel(const ExecutionPolicy& exec) {
+    for (const size_t testSize : testSizes) {
+        for (const size_t offset : testOffsets) {
+            SourceContainer source(testSize + offset);
+            iota(source.begin(), source.end(), 0);
+            const auto sourceFirst = next(source.begin(), static_cast<ptrdiff_t>(offset));
+            DestContainer dest(testSize + 2 * offset, -1);
+            const auto destFirst = next(dest.begin(), static_cast<ptrdiff_t>(offset));
+            const auto destLast  = next(destFirst, static_cast<ptrdiff_t>(testSize));
+
+            assert(copy(exec, sourceFirst, source.end(), destFirst) == destLast);
+            assert(equal(sourceFirst, source.end(), destFirst, destLast));
+            assert(all_of(dest.begin(), destFirst, [](int x) { return x == -1; }));
+            assert(all_of(destLast, dest.end(), [](int x) { return x == -1; }));
+
+            fill_n(dest.begin(), dest.size(), -1);
+            assert(copy_n(exec, sourceFirst, testSize, destFirst) == destLast);
+            assert(equal(sourceFirst, source.end(), destFirst, destLast));
+            assert(all_of(destLast, dest.end(), [](int x) { return x == -1; }));
+
+            fill_n(dest.begin(), dest.size(), -1);
+            assert(move(exec, sourceFirst, source.end(), destFirst) == destLast);
+            assert(equal(sourceFirst, source.end(), destFirst, destLast));
+            assert(all_of(destLast, dest.end(), [](int x) { return x == -1; }));
+        }
+    }
+}
+
+template <class Container, class ExecutionPolicy>
+void test_case_fill_parallel(const ExecutionPolicy& exec) {
+    for (const size_t testSize : testSizes) {
+        for (const size_t offset : testOffsets) {
+            Container c(testSize + 2 * offset, -1);
+            const auto first = next(c.begin(), static_cast<ptrdiff_t>(offset));
+            const auto last  = next(first, static_cast<ptrdiff_t>(testSize));
+
+            fill(exec, first, last, 42);
+            assert(all_of(first, last, [](int x) { return x == 42; }));
+            assert(all_of(c.begin(), first, [](int x) { return x == -1; }));
+            assert(all_of(last, c.end(), [](int x) { return x == -1; }));
+
+            assert(fill_n(exec, first, testSize, 1729) == last);
+            assert(all_of(first, last, [](int x) { return x == 1729; }));
+            assert(all_of(last, c.end(), [](int x) { return x == -1; }));
+        }
+    }
+
+    Container c(10, -1);
+    assert(fill_n(exec, c.begin(), -5, 42) == c.begin());
+    assert(copy_n(exec, c.begin(), -5, c.begin()) == c.begin());
+    assert(all_of(c.begin(), c.end(), [](int x) { return x == -1; }));
+}
+
+template <class ExecutionPolicy>
+void test_case_copy_fill_other_types(const ExecutionPolicy& exec) {
+    // element sizes that don't divide a page, or are bigger than one
+    struct triple {
+        char c[3];
+    };
+
+    vector<triple> triples(1'000'003);
+    for (size_t i = 0; i < triples.size(); ++i) {
+        triples[i].c[0] = static_cast<char>(i);
+        triples[i].c[1] = static_cast<char>(i >> 8);
+        triples[i].c[2] = static_cast<char>(i >> 16);
+    }
+
+    vector<triple> triplesCopy(triples.size());
+    copy(exec, triples.begin(), triples.end(), triplesCopy.begin());
+    assert(equal(triples.begin(), triples.end(), triplesCopy.begin(), [](const triple& lhs, const triple& rhs) {
+        return lhs.c[0] == rhs.c[0] && lhs.c[1] == rhs.c[1] && lhs.c[2] == rhs.c[2];
+    }));
+
+    struct page_and_a_half {
+        int data[1536];
+    };
+
+    auto pages = make_unique<page_and_a_half[]>(1000);
+    for (size_t i = 0; i < 1000; ++i) {
+        pages[i].data[0] = static_cast<int>(i);
+    }
+
+    auto pagesCopy = make_unique<page_and_a_half[]>(1000);
+    copy(exec, pages.get(), pages.get() + 1000, pagesCopy.get());
+    for (size_t i = 0; i < 1000; ++i) {
+        assert(pagesCopy[i].data[0] == static_cast<int>(i));
+    }
+
+    vector<double> doubles(300'001, 1.0);
+    fill(exec, doubles.begin() + 1, doubles.end(), -0.5);
+    assert(doubles[0] == 1.0);
+    assert(all_of(doubles.begin() + 1, doubles.end(), [](double x) { return x == -0.5; }));
+
+    vector<char> chars(3'000'001);
+    fill(exec, chars.begin(), chars.end(), 'x');
+    assert(all_of(chars.begin(), chars.end(), [](char x) { return x == 'x'; }));
+
+    vector<bool> bools(10'000'001);
+    fill(exec, bools.begin() + 3, bools.end() - 5, true);
+    assert(count(bools.begin(), bools.end(), true) == static_cast<ptrdiff_t>(bools.size() - 8));
+
+    vector<bool> boolsCopy(bools.size());
+    copy(exec, bools.begin(), bools.end(), boolsCopy.begin());
+    assert(bools == boolsCopy);
+
+    vector<string> strings(300'001, "meow");
+    vector<string> moved(strings.size());
+    move(exec, strings.begin(), strings.end(), moved.begin());
+    assert(all_of(moved.begin(), moved.end(), [](const string& s) { return s == "meow"; }));
+}
+
+int main() {
+    const auto parNontemporal = stdext::execution::with(par, stdext::execution::nontemporal_stores);
+
+    test_case_copy_parallel<vector<int>, vector<int>>(seq);
+    test_case_copy_parallel<vector<int>, vector<int>>(par);
+    test_case_copy_parallel<vector<int>, vector<int>>(par_unseq);
+    test_case_copy_parallel<list<int>, vector<int>>(par);
+    test_case_copy_parallel<vector<int>, list<int>>(par);
+    test_case_copy_parallel<vector<int>, vector<int>>(parNontemporal);
+
+    test_case_fill_parallel<vector<int>>(seq);
+    test_case_fill_parallel<vector<int>>(par);
+    test_case_fill_parallel<vector<int>>(par_unseq);
+    test_case_fill_parallel<list<int>>(par);
+    test_case_fill_parallel<vector<int>>(parNontemporal);
+
+    test_case_copy_fill_other_types(par);
+    test_case_copy_fill_other_types(parNontemporal);
+}
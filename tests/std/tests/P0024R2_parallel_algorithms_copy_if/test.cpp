@@ -0,0 +1,81 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <assert.h>
+#include <execution>
+#include <functional>
+#include <list>
+#include <random>
+#include <vector>
+
+#include <parallel_algorithms_utilities.hpp>
+
+using namespace std;
+using namespace std::execution;
+
+const auto is_odd      = [](unsigned int i) { return (i & 0x1u) != 0; };
+const auto is_even     = [](unsigned int i) { return (i & 0x1u) == 0; };
+const auto same_eighth = [](unsigned int a, unsigned int b) { return a / 8 == b / 8; };
+
+template <template <class...> class Container>
+void test_case_copy_if_family_parallel(const size_t testSize, mt19937& gen) {
+    Container<unsigned int> input(testSize);
+    uniform_int_distribution<unsigned int> dist(0, static_cast<unsigned int>(testSize) * 4);
+    for (int i = 0; i < 100; ++i) {
+        generate(input.begin(), input.end(), [&] { return dist(gen); });
+        vector<unsigned int> expected(testSize);
+        vector<unsigned int> expectedFalse(testSize);
+        vector<unsigned int> actual(testSize);
+        vector<unsigned int> actualFalse(testSize);
+
+        // copy_if
+        auto expectedEnd = copy_if(input.begin(), input.end(), expected.begin(), is_odd);
+        auto actualEnd   = copy_if(par, input.begin(), input.end(), actual.begin(), is_odd);
+        assert(equal(expected.begin(), expectedEnd, actual.begin(), actualEnd));
+
+        // remove_copy_if
+        expectedEnd = remove_copy_if(input.begin(), input.end(), expected.begin(), is_odd);
+        actualEnd   = remove_copy_if(par, input.begin(), input.end(), actual.begin(), is_odd);
+        assert(equal(expected.begin(), expectedEnd, actual.begin(), actualEnd));
+
+        // remove_copy
+        const auto removed = testSize == 0 ? 0U : *input.begin();
+        expectedEnd        = remove_copy(input.begin(), input.end(), expected.begin(), removed);
+        actualEnd          = remove_copy(par, input.begin(), input.end(), actual.begin(), removed);
+        assert(equal(expected.begin(), expectedEnd, actual.begin(), actualEnd));
+
+        // partition_copy
+        const auto expectedEnds =
+            partition_copy(input.begin(), input.end(), expected.begin(), expectedFalse.begin(), is_even);
+        const auto actualEnds =
+            partition_copy(par, input.begin(), input.end(), actual.begin(), actualFalse.begin(), is_even);
+        assert(equal(expected.begin(), expectedEnds.first, actual.begin(), actualEnds.first));
+        assert(equal(expectedFalse.begin(), expectedEnds.second, actualFalse.begin(), actualEnds.second));
+
+        // unique_copy
+        expectedEnd = unique_copy(input.begin(), input.end(), expected.begin(), same_eighth);
+        actualEnd   = unique_copy(par, input.begin(), input.end(), actual.begin(), same_eighth);
+        assert(equal(expected.begin(), expectedEnd, actual.begin(), actualEnd));
+
+        vector<unsigned int> sortedInput(input.begin(), input.end());
+        sort(sortedInput.begin(), sortedInput.end());
+        expectedEnd = unique_copy(sortedInput.begin(), sortedInput.end(), expected.begin());
+        actualEnd   = unique_copy(par, sortedInput.begin(), sortedInput.end(), actual.begin());
+        assert(equal(expected.begin(), expectedEnd, actual.begin(), actualEnd));
+    }
+
+    // select everything / nothing:
+    vector<unsigned int> output(testSize);
+    fill(input.begin(), input.end(), 2U);
+    assert(output.end() == copy_if(par, input.begin(), input.end(), output.begin(), is_even));
+    assert(equal(input.begin(), input.end(), output.begin(), output.end()));
+    assert(output.begin() == copy_if(par, input.begin(), input.end(), output.begin(), is_odd));
+    assert(output.begin() + (testSize == 0 ? 0 : 1) == unique_copy(par, input.begin(), input.end(), output.begin()));
+}
+
+int main() {
+    mt19937 gen(1729);
+    parallel_test_case(test_case_copy_if_family_parallel<list>, gen);
+    parallel_test_case(test_case_copy_if_family_parallel<vector>, gen);
+}
@@ -25,6 +25,10 @@ void test_case_count_parallel(const size_t testSize, mt19937& gen) {
     assert(count(par, c.begin(), c.end(), '\x01') == static_cast<ptrdiff_t>(testSize));
     assert(count_if(par, c.begin(), c.end(), is_zero) == 0);
     assert(count_if(par, c.begin(), c.end(), is_one) == static_cast<ptrdiff_t>(testSize));
+#if _HAS_CXX20
+    assert(count(unseq, c.begin(), c.end(), '\x00') == 0);
+    assert(count_if(unseq, c.begin(), c.end(), is_one) == static_cast<ptrdiff_t>(testSize));
+#endif // _HAS_CXX20
 
     vector<typename Container<char>::iterator> iterators(testSize);
     iota(iterators.begin(), iterators.end(), c.begin());
@@ -0,0 +1,176 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <assert.h>
+#include <cstdint>
+#include <execution>
+#include <list>
+#include <random>
+#include <sstream>
+#include <type_traits>
+#include <vector>
+
+using namespace std;
+using namespace std::execution;
+using stdext::philox4x32;
+using stdext::philox4x64;
+
+#define STATIC_ASSERT(...) static_assert(__VA_ARGS__, #__VA_ARGS__)
+
+STATIC_ASSERT(stdext::execution::is_discardable_generator_v<philox4x32>);
+STATIC_ASSERT(stdext::execution::is_discardable_generator_v<philox4x64>);
+STATIC_ASSERT(!stdext::execution::is_discardable_generator_v<mt19937>);
+STATIC_ASSERT(!stdext::execution::is_stateless_generator_v<philox4x32>);
+STATIC_ASSERT(is_same_v<philox4x32::result_type, uint_fast32_t>);
+STATIC_ASSERT(is_same_v<philox4x64::result_type, uint_fast64_t>);
+STATIC_ASSERT(philox4x32::word_size == 32 && philox4x32::word_count == 4 && philox4x32::round_count == 10);
+STATIC_ASSERT((philox4x32::min)() == 0 && (philox4x32::max)() == 0xFFFF'FFFFU);
+STATIC_ASSERT((philox4x64::max)() == 0xFFFF'FFFF'FFFF'FFFFULL);
+
+const size_t testSizes[] = {0, 1, 2, 3, 4, 5, 31, 32, 33, 1000, 10'007, 100'003};
+
+struct uniform_double_source { // consumes exactly one engine result per call, so it can be discarded like the engine
+    philox4x64 engine;
+
+    double operator()() {
+        return static_cast<double>(engine() >> 11) * 0x1.0p-53;
+    }
+
+    void discard(const unsigned long long count) {
+        engine.discard(count);
+    }
+};
+
+template <>
+struct stdext::execution::is_discardable_generator<uniform_double_source> : true_type {};
+
+struct forty_two {
+    int operator()() const {
+        return 42;
+    }
+};
+
+template <>
+struct stdext::execution::is_stateless_generator<forty_two> : true_type {};
+
+void test_philox_engine() {
+    // the 10000th result of a default-constructed engine, as specified for C++26 std::philox4x32 and std::philox4x64
+    philox4x32 e32;
+    e32.discard(9999);
+    assert(e32() == 1955073260U);
+
+    philox4x64 e64;
+    for (int i = 0; i < 9999; ++i) {
+        (void) e64();
+    }
+
+    assert(e64() == 3409172418970261260ULL);
+
+    for (const unsigned long long skip : {0ULL, 1ULL, 2ULL, 3ULL, 4ULL, 5ULL, 7ULL, 8ULL, 9ULL, 12'345ULL}) {
+        for (int warmup = 0; warmup < 5; ++warmup) {
+            philox4x32 stepped(1729);
+            philox4x32 skipped(1729);
+            for (int i = 0; i < warmup; ++i) {
+                (void) stepped();
+                (void) skipped();
+            }
+
+            for (unsigned long long i = 0; i < skip; ++i) {
+                (void) stepped();
+            }
+
+            skipped.discard(skip);
+            assert(stepped == skipped);
+            for (int i = 0; i < 9; ++i) {
+                assert(stepped() == skipped());
+            }
+
+            stringstream ss;
+            ss << stepped;
+            philox4x32 restored;
+            ss >> restored;
+            assert(restored == stepped);
+            for (int i = 0; i < 9; ++i) {
+                assert(restored() == stepped());
+            }
+        }
+    }
+
+    // the counter carries from one word into the next
+    philox4x32 beforeCarry;
+    beforeCarry.set_counter({0, 0, 0, 0xFFFF'FFFFU});
+    philox4x32 afterCarry = beforeCarry;
+    for (int i = 0; i < 12; ++i) {
+        (void) beforeCarry();
+    }
+
+    afterCarry.discard(12);
+    assert(beforeCarry == afterCarry);
+    assert(beforeCarry() == afterCarry());
+
+    philox4x32 far1;
+    philox4x32 far2;
+    far1.discard(1ULL << 40);
+    far1.discard(1ULL << 40);
+    far2.discard(1ULL << 41);
+    assert(far1 == far2);
+    far1.discard(~0ULL);
+    far2.discard(~0ULL - 3);
+    far2.discard(3);
+    assert(far1 == far2);
+
+    seed_seq seq{1, 2, 3};
+    philox4x64 seeded(seq);
+    philox4x64 reseeded;
+    reseeded.seed(seq);
+    assert(seeded == reseeded);
+    assert(seeded != philox4x64{});
+}
+
+template <class Container, class Generator, class ExecutionPolicy>
+void test_case_generate_parallel(const ExecutionPolicy& exec, const Generator& gen) {
+    for (const size_t testSize : testSizes) {
+        vector<typename Container::value_type> expected(testSize);
+        generate(expected.begin(), expected.end(), gen);
+
+        Container c(testSize);
+        generate(exec, c.begin(), c.end(), gen);
+        assert(equal(c.begin(), c.end(), expected.begin(), expected.end()));
+
+        Container cn(testSize + 1);
+        assert(generate_n(exec, cn.begin(), testSize, gen) == next(cn.begin(), static_cast<ptrdiff_t>(testSize)));
+        assert(equal(cn.begin(), prev(cn.end()), expected.begin(), expected.end()));
+        assert(cn.back() == typename Container::value_type{});
+    }
+
+    Container c(3);
+    assert(generate_n(exec, c.begin(), -1, gen) == c.begin());
+}
+
+template <class ExecutionPolicy>
+void test_case_generate_unannotated(const ExecutionPolicy& exec) {
+    // a stateful generator that doesn't opt in is called in order
+    vector<int> v(100'000);
+    int next = 0;
+    generate(exec, v.begin(), v.end(), [&next] { return next++; });
+    for (int i = 0; i < 100'000; ++i) {
+        assert(v[static_cast<size_t>(i)] == i);
+    }
+}
+
+int main() {
+    test_philox_engine();
+
+    test_case_generate_parallel<vector<uint_fast32_t>>(seq, philox4x32{});
+    test_case_generate_parallel<vector<uint_fast32_t>>(par, philox4x32{});
+    test_case_generate_parallel<vector<uint_fast32_t>>(par_unseq, philox4x32{12345});
+    test_case_generate_parallel<list<uint_fast32_t>>(par, philox4x32{});
+    test_case_generate_parallel<vector<uint_fast64_t>>(par, philox4x64{});
+    test_case_generate_parallel<vector<double>>(par, uniform_double_source{});
+    test_case_generate_parallel<vector<int>>(par, forty_two{});
+    test_case_generate_parallel<vector<uint_fast32_t>>(stdext::execution::with(par, stdext::execution::max_threads(3)),
+        philox4x32{});
+
+    test_case_generate_unannotated(par);
+}
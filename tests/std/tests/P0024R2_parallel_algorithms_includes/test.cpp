@@ -0,0 +1,135 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <assert.h>
+#include <execution>
+#include <functional>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <stdlib.h>
+#include <vector>
+
+#include <parallel_algorithms_utilities.hpp>
+
+using namespace std;
+using namespace std::execution;
+
+template <class T>
+void assert_message_vector(const bool b, const char* const msg, const T seedValue) {
+    if (!b) {
+        cerr << msg << " failed for seed value: " << seedValue << "\n";
+        cerr << "This is a randomized test.\n";
+        cerr << "DO NOT IGNORE/RERUN THIS FAILURE.\n";
+        cerr << "You must report it to the STL maintainers.\n";
+        abort();
+    }
+}
+
+void test_case_includes_parallel(const size_t testSize) {
+    vector<size_t> longList(testSize, 1UL);
+    vector<size_t> shortList(testSize / 2, 1UL);
+
+    const auto lb = longList.begin();
+    const auto le = longList.end();
+    const auto sb = shortList.begin();
+    const auto se = shortList.end();
+
+    // === Ranges of duplicates ===
+    // Every range includes the empty range and itself
+    assert(includes(par, lb, le, lb, lb));
+    assert(includes(par, lb, le, lb, le));
+    assert(includes(par, lb, le, lb, le, greater()));
+
+    // The longer range includes the shorter one, but not the other way around
+    assert(includes(par, lb, le, sb, se));
+    assert(includes(par, lb, le, sb, se, greater()));
+    assert(includes(par, sb, se, lb, le) == (shortList.size() == longList.size()));
+    assert(includes(par, sb, se, lb, le, greater()) == (shortList.size() == longList.size()));
+
+    if (testSize == 0) {
+        return;
+    }
+
+    // === First range and second range are completely disjoint ===
+    fill(sb, se, 2UL);
+    assert(includes(par, lb, le, sb, se) == shortList.empty());
+    assert(!includes(par, sb, se, lb, le));
+
+    // === Increasing lists ===
+    // Increasing lists starting at 1, with shortList a subset of longList
+    iota(lb, le, 1UL);
+    iota(sb, se, 1UL);
+    assert(includes(par, lb, le, sb, se));
+    assert(includes(par, sb, se, lb, le) == (shortList.size() == longList.size()));
+
+    // longList contains the even numbers, and shortList every other element of longList
+    for (auto& elem : longList) {
+        elem *= 2;
+    }
+    size_t curr = 4;
+    for (auto& elem : shortList) {
+        elem = curr;
+        curr += 4;
+    }
+    assert(includes(par, lb, le, sb, se));
+
+    // shortList containing an odd number at the beginning, middle, or end
+    if (!shortList.empty()) {
+        for (const auto missing : {sb, sb + static_cast<int>(shortList.size() / 2), se - 1}) {
+            --*missing;
+            assert(!includes(par, lb, le, sb, se));
+            ++*missing;
+        }
+    }
+
+    // === Decreasing lists ===
+    reverse(lb, le);
+    reverse(sb, se);
+    assert(includes(par, lb, le, sb, se, greater()));
+    assert(includes(par, sb, se, lb, le, greater()) == (shortList.size() == longList.size()));
+
+    // The largest element of longList appearing more often in shortList than in longList
+    fill(sb, se, longList.front());
+    assert(includes(par, lb, le, sb, se, greater()) == (shortList.size() <= 1));
+
+    // test randomized input ranges
+    const auto seedValue = random_device{}();
+    mt19937 gen(seedValue);
+    uniform_int_distribution<> dis(0, static_cast<int>(testSize));
+
+    vector<int> list1(testSize);
+    for (auto& elem : list1) {
+        elem = dis(gen);
+    }
+
+    sort(list1.begin(), list1.end());
+
+    // remove a random subset of list1; the remaining elements are always included
+    vector<int> list2;
+    bernoulli_distribution keep(0.5);
+    for (const auto& elem : list1) {
+        if (keep(gen)) {
+            list2.push_back(elem);
+        }
+    }
+
+    assert_message_vector(includes(par, list1.begin(), list1.end(), list2.begin(), list2.end()),
+        "Randomized vectors, includes 1", seedValue);
+
+    // perturb one element of list2, which may or may not still be included
+    if (!list2.empty()) {
+        uniform_int_distribution<size_t> index(0, list2.size() - 1);
+        auto& victim = list2[index(gen)];
+        victim       = dis(gen);
+        sort(list2.begin(), list2.end());
+        assert_message_vector(includes(list1.begin(), list1.end(), list2.begin(), list2.end())
+                                  == includes(par, list1.begin(), list1.end(), list2.begin(), list2.end()),
+            "Randomized vectors, includes 2", seedValue);
+    }
+}
+
+int main() {
+    parallel_test_case(test_case_includes_parallel);
+}
@@ -0,0 +1,166 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <assert.h>
+#include <chrono>
+#include <execution>
+#include <mutex>
+#include <new>
+#include <numeric>
+#include <random>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+using namespace std;
+using namespace std::execution;
+using stdext::execution::parallel_region_callback;
+using stdext::execution::parallel_region_report;
+using stdext::execution::set_parallel_region_callback;
+
+#define STATIC_ASSERT(...) static_assert(__VA_ARGS__, #__VA_ARGS__)
+
+STATIC_ASSERT(_STL_INSTRUMENT_PARALLEL_ALGORITHMS == 1);
+STATIC_ASSERT(is_same_v<parallel_region_callback, void (*)(const parallel_region_report&) noexcept>);
+STATIC_ASSERT(noexcept(set_parallel_region_callback(nullptr)));
+
+#pragma warning(disable : 28251) // Inconsistent annotation for 'new': this instance has no annotations.
+
+// the parallel algorithms allocate their scratch space with nothrow new; failing it simulates exhausted resources
+bool fail_nothrow_new = false;
+
+void* operator new(size_t size, const nothrow_t&) noexcept {
+    if (fail_nothrow_new) {
+        return nullptr;
+    }
+
+    try {
+        return ::operator new(size);
+    } catch (const bad_alloc&) {
+        return nullptr;
+    }
+}
+
+mutex reportsLock;
+vector<parallel_region_report> reports;
+
+void record_report(const parallel_region_report& report) noexcept {
+    lock_guard<mutex> lck(reportsLock);
+    reports.push_back(report);
+}
+
+void ignore_report(const parallel_region_report&) noexcept {}
+
+vector<parallel_region_report> take_reports() {
+    lock_guard<mutex> lck(reportsLock);
+    return exchange(reports, {});
+}
+
+void check_reports(const vector<parallel_region_report>& regions) {
+    for (const auto& report : regions) {
+        if (report.resources_exhausted) {
+            assert(report.operation == nullptr);
+            assert(report.submissions == 0);
+            continue;
+        }
+
+        assert(report.operation != nullptr);
+        assert(report.threads >= 2);
+        assert(report.submissions >= 1);
+        assert(report.threads <= report.submissions + 1);
+        assert(report.submit_time.count() >= 0);
+        assert(report.elapsed_time >= report.submit_time);
+    }
+}
+
+void test_callback_registration() {
+    assert(set_parallel_region_callback(&record_report) == nullptr);
+    assert(set_parallel_region_callback(&ignore_report) == &record_report);
+    assert(set_parallel_region_callback(&record_report) == &ignore_report);
+}
+
+void test_chunked_region() {
+    vector<int> v(1'000'000);
+    iota(v.begin(), v.end(), 0);
+    take_reports();
+    for_each(par, v.begin(), v.end(), [](int& x) { x *= 2; });
+    const auto regions = take_reports();
+    check_reports(regions);
+    for (const auto& report : regions) {
+        if (!report.resources_exhausted) {
+            assert(report.chunks >= report.submissions);
+            assert(report.steals == 0);
+        }
+    }
+
+    for (int i = 0; i < 1'000'000; ++i) {
+        assert(v[static_cast<size_t>(i)] == i * 2);
+    }
+}
+
+void test_work_stealing_region() {
+    vector<unsigned int> v(1'000'000);
+    mt19937 gen(1729);
+    generate(v.begin(), v.end(), ref(gen));
+    take_reports();
+    sort(par, v.begin(), v.end());
+    check_reports(take_reports());
+    assert(is_sorted(v.begin(), v.end()));
+}
+
+void test_limited_region() {
+    // threads reports what was submitted, not what the policy allowed
+    vector<int> v(1'000'000);
+    take_reports();
+    for_each(stdext::execution::with(par, stdext::execution::max_threads(2)), v.begin(), v.end(), [](int& x) { ++x; });
+    const auto regions = take_reports();
+    check_reports(regions);
+    for (const auto& report : regions) {
+        assert(report.threads <= 2);
+    }
+
+    assert(all_of(v.begin(), v.end(), [](int x) { return x == 1; }));
+}
+
+void test_resources_exhausted() {
+    vector<long long> v(1'000'000);
+    iota(v.begin(), v.end(), 0LL);
+    take_reports();
+    fail_nothrow_new    = true;
+    const long long sum = reduce(par, v.begin(), v.end(), 0LL);
+    fail_nothrow_new    = false;
+    assert(sum == 999'999LL * 1'000'000LL / 2);
+    const auto regions = take_reports();
+    check_reports(regions);
+    if (thread::hardware_concurrency() > 1) {
+        assert(regions.size() == 1);
+        assert(regions[0].resources_exhausted);
+    }
+}
+
+void test_serial_policies_do_not_report() {
+    vector<int> v(1'000'000, 1);
+    take_reports();
+    for_each(seq, v.begin(), v.end(), [](int& x) { ++x; });
+    for_each(stdext::execution::with(par, stdext::execution::max_threads(1)), v.begin(), v.end(), [](int& x) { ++x; });
+    assert(take_reports().empty());
+    assert(all_of(v.begin(), v.end(), [](int x) { return x == 3; }));
+}
+
+void test_uninstalled_callback() {
+    assert(set_parallel_region_callback(nullptr) == &record_report);
+    vector<int> v(1'000'000, 1);
+    for_each(par, v.begin(), v.end(), [](int& x) { ++x; });
+    assert(take_reports().empty());
+}
+
+int main() {
+    test_callback_registration();
+    test_chunked_region();
+    test_work_stealing_region();
+    test_limited_region();
+    test_resources_exhausted();
+    test_serial_policies_do_not_report();
+    test_uninstalled_callback();
+}
@@ -0,0 +1,73 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <assert.h>
+#include <execution>
+#include <forward_list>
+#include <functional>
+#include <numeric>
+#include <vector>
+
+using namespace std;
+using namespace std::execution;
+
+// sizes on both sides of the point where lexicographical_compare goes parallel (1 MiB of elements)
+const size_t testSizes[] = {0, 1, 2, 3, 1000, 262'143, 262'144, 262'145, 1'000'001};
+
+template <class ExecutionPolicy>
+void test_case_lexicographical_compare_parallel(const ExecutionPolicy& exec) {
+    for (const size_t testSize : testSizes) {
+        vector<int> v(testSize);
+        iota(v.begin(), v.end(), 0);
+        vector<int> w = v;
+        assert(!lexicographical_compare(exec, v.begin(), v.end(), w.begin(), w.end()));
+        assert(!lexicographical_compare(exec, v.begin(), v.end(), w.begin(), w.end(), greater<>{}));
+        if (testSize == 0) {
+            continue;
+        }
+
+        // proper prefixes
+        assert(lexicographical_compare(exec, v.begin(), v.end() - 1, w.begin(), w.end()));
+        assert(!lexicographical_compare(exec, v.begin(), v.end(), w.begin(), w.end() - 1));
+
+        // differences at the front, the middle, and the back
+        for (const size_t pos : {size_t{0}, testSize / 2, testSize - 1}) {
+            ++w[pos];
+            assert(lexicographical_compare(exec, v.begin(), v.end(), w.begin(), w.end()));
+            assert(!lexicographical_compare(exec, w.begin(), w.end(), v.begin(), v.end()));
+            assert(!lexicographical_compare(exec, v.begin(), v.end(), w.begin(), w.end(), greater<>{}));
+            assert(lexicographical_compare(exec, w.begin(), w.end(), v.begin(), v.end(), greater<>{}));
+
+            // an earlier difference decides the order
+            if (pos != 0) {
+                --w[0];
+                assert(!lexicographical_compare(exec, v.begin(), v.end(), w.begin(), w.end()));
+                ++w[0];
+            }
+
+            --w[pos];
+        }
+
+        // equivalent but not equal elements don't decide the order
+        const auto lessByHalves = [](int lhs, int rhs) { return lhs / 2 < rhs / 2; };
+        for (auto& x : w) {
+            x ^= 1;
+        }
+
+        assert(!lexicographical_compare(exec, v.begin(), v.end(), w.begin(), w.end(), lessByHalves));
+        assert(!lexicographical_compare(exec, w.begin(), w.end(), v.begin(), v.end(), lessByHalves));
+    }
+
+    forward_list<int> fl(300'000, 7);
+    forward_list<int> fl2 = fl;
+    fl2.push_front(6);
+    assert(lexicographical_compare(exec, fl2.begin(), fl2.end(), fl.begin(), fl.end()));
+    assert(!lexicographical_compare(exec, fl.begin(), fl.end(), fl2.begin(), fl2.end()));
+}
+
+int main() {
+    test_case_lexicographical_compare_parallel(seq);
+    test_case_lexicographical_compare_parallel(par);
+    test_case_lexicographical_compare_parallel(par_unseq);
+}
@@ -0,0 +1,178 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <assert.h>
+#include <atomic>
+#include <cmath>
+#include <cstring>
+#include <execution>
+#include <new>
+#include <numeric>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+using namespace std;
+using namespace std::execution;
+using stdext::execution::deterministic_reduce;
+using stdext::execution::limited_policy;
+using stdext::execution::max_threads;
+using stdext::execution::min_chunk;
+using stdext::execution::nontemporal_stores;
+using stdext::execution::with;
+
+#define STATIC_ASSERT(...) static_assert(__VA_ARGS__, #__VA_ARGS__)
+
+STATIC_ASSERT(is_same_v<decltype(with(par, max_threads(2))), limited_policy<parallel_policy>>);
+STATIC_ASSERT(is_same_v<decltype(with(with(par, max_threads(2)), min_chunk(8))), limited_policy<parallel_policy>>);
+STATIC_ASSERT(is_execution_policy_v<limited_policy<sequenced_policy>>);
+STATIC_ASSERT(is_execution_policy_v<limited_policy<parallel_policy>>);
+STATIC_ASSERT(is_execution_policy_v<limited_policy<parallel_unsequenced_policy>>);
+STATIC_ASSERT(is_same_v<decltype(with(par_unseq, deterministic_reduce)), limited_policy<parallel_unsequenced_policy>>);
+STATIC_ASSERT(is_same_v<decltype(with(par, nontemporal_stores, max_threads(2))), limited_policy<parallel_policy>>);
+
+#pragma warning(disable : 28251) // Inconsistent annotation for 'new': this instance has no annotations.
+
+// the parallel algorithms allocate their scratch space with nothrow new; failing it simulates exhausted resources
+bool fail_nothrow_new = false;
+
+void* operator new(size_t size, const nothrow_t&) noexcept {
+    if (fail_nothrow_new) {
+        return nullptr;
+    }
+
+    try {
+        return ::operator new(size);
+    } catch (const bad_alloc&) {
+        return nullptr;
+    }
+}
+
+template <class ExPo>
+void test_limited_policy(const ExPo& exec) {
+    for (size_t testSize = 0; testSize < 5000; testSize = testSize * 3 + 1) {
+        const auto n = static_cast<long long>(testSize);
+        vector<int> v(testSize);
+        iota(v.begin(), v.end(), 0);
+        assert(count_if(exec, v.begin(), v.end(), [](int x) { return x % 2 == 0; })
+               == static_cast<ptrdiff_t>((testSize + 1) / 2));
+        assert(all_of(exec, v.begin(), v.end(), [](int x) { return x >= 0; }));
+        for_each(exec, v.begin(), v.end(), [](int& x) { x = -x; });
+        assert(is_sorted(exec, v.begin(), v.end(), greater<>{}));
+        sort(exec, v.begin(), v.end());
+        assert(is_sorted(v.begin(), v.end()));
+        stable_sort(exec, v.begin(), v.end(), greater<>{});
+        assert(is_sorted(v.begin(), v.end(), greater<>{}));
+        assert(reduce(exec, v.begin(), v.end(), 0LL) == -(n * (n - 1) / 2));
+    }
+}
+
+void test_max_threads_caps_concurrency() {
+    // no more than max_threads callers of the element access functions may be running at once
+    vector<int> v(100'000);
+    iota(v.begin(), v.end(), 0);
+    for (const size_t threads : {1, 2, 3}) {
+        atomic<size_t> active{0};
+        atomic<size_t> peak{0};
+        const auto track = [&] {
+            const size_t now = active.fetch_add(1) + 1;
+            size_t old       = peak.load();
+            while (old < now && !peak.compare_exchange_weak(old, now)) {
+            }
+
+            active.fetch_sub(1);
+        };
+
+        const auto exec = with(par, max_threads(threads));
+        assert(count_if(exec, v.begin(), v.end(), [&](int x) {
+            track();
+            return x % 2 == 0;
+        }) == 50'000);
+        for_each(exec, v.begin(), v.end(), [&](int) { track(); });
+        sort(exec, v.begin(), v.end(), [&](int lhs, int rhs) {
+            track();
+            return lhs > rhs;
+        });
+        stable_sort(exec, v.begin(), v.end(), [&](int lhs, int rhs) {
+            track();
+            return lhs < rhs;
+        });
+        assert(is_sorted(v.begin(), v.end()));
+        assert(peak.load() <= threads);
+    }
+}
+
+bool same_bits(const double lhs, const double rhs) {
+    return memcmp(&lhs, &rhs, sizeof(double)) == 0;
+}
+
+void test_deterministic_reduce() {
+    // floating-point sums of values with widely varying magnitudes depend on the order of additions; in deterministic
+    // mode that order must not depend on the number of threads or on scheduling
+    mt19937 gen(1729);
+    uniform_real_distribution<double> mantissa(-1.0, 1.0);
+    uniform_int_distribution<int> exponent(-20, 20);
+    for (const size_t testSize : {0, 1, 2, 3, 2047, 2048, 4097, 100'000, 1'000'003}) {
+        vector<double> v(testSize);
+        for (auto& x : v) {
+            x = ldexp(mantissa(gen), exponent(gen));
+        }
+
+        const auto square  = [](double x) { return x * x; };
+        const auto base    = with(par, deterministic_reduce, max_threads(1));
+        const double sum   = reduce(base, v.begin(), v.end(), 0.5);
+        const double sumSq = transform_reduce(base, v.begin(), v.end(), 0.0, plus<>{}, square);
+        const double dot   = transform_reduce(base, v.begin(), v.end(), v.rbegin(), 0.0);
+        for (const size_t threads : {1, 2, 3, 4, 8, 64}) {
+            for (int run = 0; run < 3; ++run) {
+                const auto exec = with(par, deterministic_reduce, max_threads(threads));
+                assert(same_bits(reduce(exec, v.begin(), v.end(), 0.5), sum));
+                assert(same_bits(transform_reduce(exec, v.begin(), v.end(), 0.0, plus<>{}, square), sumSq));
+                assert(same_bits(transform_reduce(exec, v.begin(), v.end(), v.rbegin(), 0.0), dot));
+            }
+        }
+
+        const auto unseqExec = with(par_unseq, deterministic_reduce);
+        assert(same_bits(reduce(unseqExec, v.begin(), v.end(), 0.5), sum));
+        assert(same_bits(transform_reduce(unseqExec, v.begin(), v.end(), 0.0, plus<>{}, square), sumSq));
+        assert(same_bits(transform_reduce(unseqExec, v.begin(), v.end(), v.rbegin(), 0.0), dot));
+
+        // policies that don't parallelize still use the same chunks and combination order
+        const auto seqExec = with(seq, deterministic_reduce);
+        assert(same_bits(reduce(seqExec, v.begin(), v.end(), 0.5), sum));
+        assert(same_bits(transform_reduce(seqExec, v.begin(), v.end(), 0.0, plus<>{}, square), sumSq));
+        assert(same_bits(transform_reduce(seqExec, v.begin(), v.end(), v.rbegin(), 0.0), dot));
+#if _HAS_CXX20
+        const auto unseqOnlyExec = with(unseq, deterministic_reduce);
+        assert(same_bits(reduce(unseqOnlyExec, v.begin(), v.end(), 0.5), sum));
+        assert(same_bits(transform_reduce(unseqOnlyExec, v.begin(), v.end(), 0.0, plus<>{}, square), sumSq));
+        assert(same_bits(transform_reduce(unseqOnlyExec, v.begin(), v.end(), v.rbegin(), 0.0), dot));
+#endif // _HAS_CXX20
+
+        // so does the fallback to this thread when the parallel algorithm can't allocate its chunk results
+        const auto parExec       = with(par, deterministic_reduce);
+        fail_nothrow_new         = true;
+        const double failedSum   = reduce(parExec, v.begin(), v.end(), 0.5);
+        const double failedSumSq = transform_reduce(parExec, v.begin(), v.end(), 0.0, plus<>{}, square);
+        const double failedDot   = transform_reduce(parExec, v.begin(), v.end(), v.rbegin(), 0.0);
+        fail_nothrow_new         = false;
+        assert(same_bits(failedSum, sum));
+        assert(same_bits(failedSumSq, sumSq));
+        assert(same_bits(failedDot, dot));
+    }
+}
+
+int main() {
+    test_limited_policy(with(par, max_threads(1)));
+    test_limited_policy(with(par, max_threads(0))); // treated as 1
+    test_limited_policy(with(par, max_threads(2)));
+    test_limited_policy(with(par_unseq, min_chunk(1000)));
+    test_limited_policy(with(par, max_threads(3), min_chunk(64)));
+    test_limited_policy(with(seq, max_threads(4)));
+    test_limited_policy(with(par, min_chunk(0))); // treated as 1
+    test_limited_policy(with(par, deterministic_reduce));
+    test_limited_policy(with(par, nontemporal_stores));
+    test_max_threads_caps_concurrency();
+    test_deterministic_reduce();
+}
@@ -0,0 +1,130 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <assert.h>
+#include <execution>
+#include <functional>
+#include <list>
+#include <random>
+#include <vector>
+
+#include <parallel_algorithms_utilities.hpp>
+
+using namespace std;
+using namespace std::execution;
+
+const auto cmpTens = [](auto a, auto b) { return a / 10 < b / 10; };
+
+vector<size_t> get_sorted_test_case_vector(const size_t testSize, const size_t tag, mt19937& gen) {
+    // values with equal tens digits are equivalent under cmpTens; tag records which input an element came from, so
+    // stability can be checked
+    vector<size_t> c(testSize);
+    uniform_int_distribution<size_t> dist(static_cast<size_t>(0), testSize);
+    for (auto& elem : c) {
+        elem = dist(gen) * 10 + tag;
+    }
+
+    sort(c.begin(), c.end());
+    return c;
+}
+
+template <template <class...> class Container>
+void test_case_merge_parallel_special_cases() {
+    const Container<int> empty;
+    const Container<int> one({1});
+    const Container<int> two({0, 2});
+    const Container<int> twoDescending({2, 0});
+    vector<int> result(3);
+    auto resultEnd = merge(par, empty.begin(), empty.end(), empty.begin(), empty.end(), result.begin());
+    assert(resultEnd == result.begin());
+    resultEnd = merge(par, one.begin(), one.end(), empty.begin(), empty.end(), result.begin());
+    assert(resultEnd == result.begin() + 1);
+    assert(result[0] == 1);
+    resultEnd = merge(par, empty.begin(), empty.end(), one.begin(), one.end(), result.begin());
+    assert(resultEnd == result.begin() + 1);
+    assert(result[0] == 1);
+    resultEnd = merge(par, one.begin(), one.end(), two.begin(), two.end(), result.begin());
+    assert(resultEnd == result.end());
+    assert(result == vector<int>({0, 1, 2}));
+    resultEnd = merge(par, twoDescending.begin(), twoDescending.end(), one.begin(), one.end(), result.begin(),
+        greater<>{});
+    assert(resultEnd == result.end());
+    assert(result == vector<int>({2, 1, 0}));
+}
+
+template <template <class...> class Container>
+void test_case_inplace_merge_parallel_special_cases() {
+    Container<int> testData;
+    inplace_merge(par, testData.begin(), testData.begin(), testData.end()); // empty range
+    testData.push_back(1);
+    inplace_merge(par, testData.begin(), testData.begin(), testData.end()); // 1 element
+    inplace_merge(par, testData.begin(), testData.end(), testData.end());
+    assert(testData == Container<int>({1}));
+    testData.push_back(0);
+    inplace_merge(par, testData.begin(), next(testData.begin()), testData.end());
+    assert(testData == Container<int>({0, 1}));
+    testData.clear();
+    testData.push_back(11);
+    testData.push_back(25);
+    testData.push_back(10);
+    inplace_merge(par, testData.begin(), next(testData.begin(), 2), testData.end(), cmpTens);
+    assert(testData == Container<int>({11, 10, 25}));
+}
+
+void test_case_merge_parallel(const size_t testSize, mt19937& gen) {
+    const auto left  = get_sorted_test_case_vector(testSize, 1, gen);
+    const auto right = get_sorted_test_case_vector(testSize / 2 + 1, 2, gen);
+    vector<size_t> expected(left.size() + right.size());
+    merge(left.begin(), left.end(), right.begin(), right.end(), expected.begin(), cmpTens);
+
+    vector<size_t> result(expected.size());
+    auto resultEnd = merge(par, left.begin(), left.end(), right.begin(), right.end(), result.begin(), cmpTens);
+    assert(resultEnd == result.end());
+    assert(result == expected);
+
+    merge(right.begin(), right.end(), left.begin(), left.end(), expected.begin(), cmpTens);
+    resultEnd = merge(par, right.begin(), right.end(), left.begin(), left.end(), result.begin(), cmpTens);
+    assert(resultEnd == result.end());
+    assert(result == expected);
+
+    merge(left.begin(), left.end(), right.begin(), right.end(), expected.begin());
+    resultEnd = merge(par, left.begin(), left.end(), right.begin(), right.end(), result.begin());
+    assert(resultEnd == result.end());
+    assert(result == expected);
+
+    // non-random-access iterators take the serial path
+    const list<size_t> leftList(left.begin(), left.end());
+    const list<size_t> rightList(right.begin(), right.end());
+    list<size_t> resultList(expected.size());
+    merge(par, leftList.begin(), leftList.end(), rightList.begin(), rightList.end(), resultList.begin());
+    assert(equal(resultList.begin(), resultList.end(), expected.begin(), expected.end()));
+}
+
+void test_case_inplace_merge_parallel(const size_t testSize, mt19937& gen) {
+    const auto left  = get_sorted_test_case_vector(testSize, 1, gen);
+    const auto right = get_sorted_test_case_vector(testSize / 2 + 1, 2, gen);
+    vector<size_t> expected(left.size() + right.size());
+    merge(left.begin(), left.end(), right.begin(), right.end(), expected.begin(), cmpTens);
+
+    vector<size_t> c(left);
+    c.insert(c.end(), right.begin(), right.end());
+    inplace_merge(par, c.begin(), c.begin() + static_cast<ptrdiff_t>(left.size()), c.end(), cmpTens);
+    assert(c == expected);
+
+    list<size_t> cList(left.begin(), left.end());
+    cList.insert(cList.end(), right.begin(), right.end());
+    inplace_merge(par, cList.begin(), next(cList.begin(), static_cast<ptrdiff_t>(left.size())), cList.end(), cmpTens);
+    assert(equal(cList.begin(), cList.end(), expected.begin(), expected.end()));
+}
+
+int main() {
+    test_case_merge_parallel_special_cases<vector>();
+    test_case_merge_parallel_special_cases<list>();
+    test_case_inplace_merge_parallel_special_cases<vector>();
+    test_case_inplace_merge_parallel_special_cases<list>();
+
+    mt19937 gen(1729);
+    parallel_test_case(test_case_merge_parallel, gen);
+    parallel_test_case(test_case_inplace_merge_parallel, gen);
+}
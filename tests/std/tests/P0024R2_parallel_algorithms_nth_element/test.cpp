@@ -0,0 +1,105 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <assert.h>
+#include <execution>
+#include <functional>
+#include <list>
+#include <random>
+#include <vector>
+
+#include <parallel_algorithms_utilities.hpp>
+
+using namespace std;
+using namespace std::execution;
+
+vector<size_t> get_test_case_vector(const size_t testSize, mt19937& gen) {
+    // parallel selection only engages above the insertion sort threshold, so scale up the "interesting" sizes;
+    // values are drawn from a small range to produce runs of duplicates
+    vector<size_t> c(testSize * 40 + testSize / 2);
+    uniform_int_distribution<size_t> dist(static_cast<size_t>(0), testSize * 10);
+    for (auto& elem : c) {
+        elem = dist(gen);
+    }
+
+    return c;
+}
+
+template <class Pr>
+void assert_nth_element_test_case(const vector<size_t>& c, const size_t nth, Pr pred) {
+    const auto nthIt = c.begin() + static_cast<ptrdiff_t>(nth);
+    assert(all_of(c.begin(), nthIt, [&](size_t val) { return !pred(*nthIt, val); }));
+    assert(all_of(nthIt, c.end(), [&](size_t val) { return !pred(val, *nthIt); }));
+}
+
+void test_case_nth_element_parallel(const size_t testSize, mt19937& gen) {
+    const auto original = get_test_case_vector(testSize, gen);
+    auto expected       = original;
+    sort(expected.begin(), expected.end());
+
+    const size_t positions[] = {0, original.size() / 4, original.size() / 2, original.size() - 1};
+    for (const size_t nth : positions) {
+        if (nth >= original.size()) {
+            continue;
+        }
+
+        auto c           = original;
+        const auto nthIt = c.begin() + static_cast<ptrdiff_t>(nth);
+        nth_element(par, c.begin(), nthIt, c.end());
+        assert(*nthIt == expected[nth]);
+        assert_nth_element_test_case(c, nth, less<>{});
+
+        c = original;
+        nth_element(par, c.begin(), nthIt, c.end(), greater<>{});
+        assert(*nthIt == expected[expected.size() - 1 - nth]);
+        assert_nth_element_test_case(c, nth, greater<>{});
+    }
+
+    // all elements equivalent
+    vector<size_t> same(original.size(), 42);
+    nth_element(par, same.begin(), same.begin() + static_cast<ptrdiff_t>(same.size() / 2), same.end());
+    assert(all_of(same.begin(), same.end(), [](size_t val) { return val == 42; }));
+}
+
+void test_case_partial_sort_parallel(const size_t testSize, mt19937& gen) {
+    const auto original = get_test_case_vector(testSize, gen);
+    auto expected       = original;
+    sort(expected.begin(), expected.end());
+
+    const size_t mids[] = {0, 1, original.size() / 3, original.size()};
+    for (const size_t mid : mids) {
+        if (mid > original.size()) {
+            continue;
+        }
+
+        const auto midDiff = static_cast<ptrdiff_t>(mid);
+        auto c             = original;
+        partial_sort(par, c.begin(), c.begin() + midDiff, c.end());
+        assert(equal(c.begin(), c.begin() + midDiff, expected.begin()));
+        sort(c.begin() + midDiff, c.end());
+        assert(c == expected);
+
+        vector<size_t> result(mid);
+        auto resultEnd = partial_sort_copy(par, original.begin(), original.end(), result.begin(), result.end());
+        assert(resultEnd == result.end());
+        assert(equal(result.begin(), result.end(), expected.begin()));
+
+        const list<size_t> originalList(original.begin(), original.end());
+        resultEnd = partial_sort_copy(par, originalList.begin(), originalList.end(), result.begin(), result.end());
+        assert(resultEnd == result.end());
+        assert(equal(result.begin(), result.end(), expected.begin()));
+    }
+
+    // output larger than input
+    vector<size_t> result(original.size() + 1);
+    const auto resultEnd = partial_sort_copy(par, original.begin(), original.end(), result.begin(), result.end());
+    assert(resultEnd == result.begin() + static_cast<ptrdiff_t>(original.size()));
+    assert(equal(result.begin(), resultEnd, expected.begin(), expected.end()));
+}
+
+int main() {
+    mt19937 gen(1729);
+    parallel_test_case(test_case_nth_element_parallel, gen);
+    parallel_test_case(test_case_partial_sort_parallel, gen);
+}
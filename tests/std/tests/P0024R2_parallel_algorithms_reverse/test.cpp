@@ -0,0 +1,83 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <assert.h>
+#include <execution>
+#include <list>
+#include <numeric>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace std::execution;
+
+// sizes on both sides of the point where reverse goes parallel (1 MiB of elements)
+const size_t testSizes[] = {0, 1, 2, 3, 4, 1000, 262'143, 262'144, 262'145, 1'000'001};
+
+template <class Container, class ExecutionPolicy>
+void test_case_reverse_parallel(const ExecutionPolicy& exec) {
+    for (const size_t testSize : testSizes) {
+        Container c(testSize);
+        iota(c.begin(), c.end(), 0);
+        reverse(exec, c.begin(), c.end());
+        int expected = static_cast<int>(testSize);
+        for (const int x : c) {
+            assert(x == --expected);
+        }
+
+        vector<int> dest(testSize, -1);
+        assert(reverse_copy(exec, c.begin(), c.end(), dest.begin()) == dest.end());
+        expected = 0;
+        for (const int x : dest) {
+            assert(x == expected++);
+        }
+    }
+}
+
+template <class ExecutionPolicy>
+void test_case_reverse_nontrivial_parallel(const ExecutionPolicy& exec) {
+    vector<string> v(100'001);
+    for (size_t i = 0; i < v.size(); ++i) {
+        v[i] = to_string(i);
+    }
+
+    reverse(exec, v.begin(), v.end());
+    for (size_t i = 0; i < v.size(); ++i) {
+        assert(v[i] == to_string(v.size() - 1 - i));
+    }
+
+    vector<char> chars(3'000'001);
+    for (size_t i = 0; i < chars.size(); ++i) {
+        chars[i] = static_cast<char>(i % 127);
+    }
+
+    vector<char> reversed(chars.size());
+    reverse_copy(exec, chars.begin(), chars.end(), reversed.begin());
+    reverse(exec, reversed.begin(), reversed.end());
+    assert(chars == reversed);
+}
+
+template <class ExecutionPolicy>
+void test_case_reverse_vector_bool_parallel(const ExecutionPolicy& exec) {
+    // vector<bool> packs elements into words, so it stays serial
+    vector<bool> bools(4'000'003);
+    for (size_t i = 0; i < bools.size(); i += 3) {
+        bools[i] = true;
+    }
+
+    vector<bool> reversed(bools.size());
+    reverse_copy(exec, bools.begin(), bools.end(), reversed.begin());
+    assert(reversed.front() && !reversed[1]);
+    reverse(exec, reversed.begin(), reversed.end());
+    assert(bools == reversed);
+}
+
+int main() {
+    test_case_reverse_parallel<vector<int>>(seq);
+    test_case_reverse_parallel<vector<int>>(par);
+    test_case_reverse_parallel<vector<int>>(par_unseq);
+    test_case_reverse_parallel<list<int>>(par);
+    test_case_reverse_nontrivial_parallel(par);
+    test_case_reverse_vector_bool_parallel(par);
+}
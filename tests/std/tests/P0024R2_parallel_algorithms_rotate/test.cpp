@@ -0,0 +1,96 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <assert.h>
+#include <execution>
+#include <forward_list>
+#include <list>
+#include <numeric>
+#include <vector>
+
+using namespace std;
+using namespace std::execution;
+
+// sizes on both sides of the point where rotate goes parallel (1 MiB of elements)
+const size_t testSizes[] = {0, 1, 2, 3, 1000, 262'143, 262'144, 262'145, 1'000'001};
+
+template <class Container>
+bool is_rotated_iota(const Container& c, const size_t testSize, const size_t shift) {
+    // test if c is 0, 1, ..., testSize - 1, rotated left by shift positions
+    size_t expected = shift;
+    for (const int x : c) {
+        if (expected == testSize) {
+            expected = 0;
+        }
+
+        if (x != static_cast<int>(expected++)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+template <class Container, class ExecutionPolicy>
+void test_case_rotate_parallel(const ExecutionPolicy& exec) {
+    for (const size_t testSize : testSizes) {
+        for (const size_t shift : {size_t{0}, size_t{1}, testSize / 3, testSize / 2, testSize - 1, testSize}) {
+            if (shift > testSize) {
+                continue; // testSize - 1 for testSize == 0
+            }
+
+            Container c(testSize);
+            iota(c.begin(), c.end(), 0);
+            const auto mid = next(c.begin(), static_cast<ptrdiff_t>(shift));
+            vector<int> dest(testSize, -1);
+            assert(rotate_copy(exec, c.begin(), mid, c.end(), dest.begin()) == dest.end());
+            assert(is_rotated_iota(dest, testSize, shift));
+
+            const auto result = rotate(exec, c.begin(), mid, c.end());
+            assert(result == next(c.begin(), static_cast<ptrdiff_t>(testSize - shift)));
+            assert(is_rotated_iota(c, testSize, shift));
+        }
+    }
+}
+
+#if _HAS_CXX20
+template <class ExecutionPolicy>
+void test_case_shift_parallel(const ExecutionPolicy& exec) {
+    for (const size_t testSize : testSizes) {
+        for (const size_t shift : {size_t{0}, size_t{1}, testSize / 3, testSize / 2, testSize - 1, testSize}) {
+            if (shift > testSize) {
+                continue;
+            }
+
+            const auto diffShift = static_cast<ptrdiff_t>(shift);
+            vector<int> v(testSize);
+            iota(v.begin(), v.end(), 0);
+            assert(shift_left(exec, v.begin(), v.end(), diffShift) == v.end() - diffShift);
+            for (size_t i = 0; i < testSize - shift; ++i) {
+                assert(v[i] == static_cast<int>(i + shift));
+            }
+
+            iota(v.begin(), v.end(), 0);
+            const auto result = shift_right(exec, v.begin(), v.end(), diffShift);
+            assert(result == (shift == testSize ? v.end() : v.begin() + diffShift));
+            for (size_t i = shift; i < testSize; ++i) {
+                assert(v[i] == static_cast<int>(i - shift));
+            }
+        }
+    }
+}
+#endif // _HAS_CXX20
+
+int main() {
+    test_case_rotate_parallel<vector<int>>(seq);
+    test_case_rotate_parallel<vector<int>>(par);
+    test_case_rotate_parallel<vector<int>>(par_unseq);
+    test_case_rotate_parallel<list<int>>(par);
+    test_case_rotate_parallel<forward_list<int>>(par);
+#if _HAS_CXX20
+    test_case_shift_parallel(seq);
+    test_case_shift_parallel(par);
+    test_case_shift_parallel(par_unseq);
+#endif // _HAS_CXX20
+}
@@ -0,0 +1,146 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <assert.h>
+#include <execution>
+#include <functional>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <stdlib.h>
+#include <vector>
+
+#include <parallel_algorithms_utilities.hpp>
+
+using namespace std;
+using namespace std::execution;
+
+template <class T>
+void assert_message_vector(const bool b, const char* const msg, const T seedValue) {
+    if (!b) {
+        cerr << msg << " failed for seed value: " << seedValue << "\n";
+        cerr << "This is a randomized test.\n";
+        cerr << "DO NOT IGNORE/RERUN THIS FAILURE.\n";
+        cerr << "You must report it to the STL maintainers.\n";
+        abort();
+    }
+}
+
+void test_case_set_union_parallel(const size_t testSize) {
+    vector<size_t> longList(testSize, 1UL);
+    vector<size_t> shortList(testSize / 2, 1UL);
+    vector<size_t> result(testSize * 2);
+
+    const int shortListSize = static_cast<int>(shortList.size());
+
+    const auto lb = longList.begin();
+    const auto le = longList.end();
+    const auto sb = shortList.begin();
+    const auto se = shortList.end();
+    const auto rb = result.begin();
+
+    // === Ranges of duplicates ===
+    // The union of ranges of duplicates is the longer of the two
+    auto compare_result = set_union(par, lb, le, sb, se, rb);
+    assert(equal(rb, compare_result, lb, le));
+    compare_result = set_union(par, lb, le, sb, se, rb, greater());
+    assert(equal(rb, compare_result, lb, le));
+    compare_result = set_union(par, sb, se, lb, le, rb);
+    assert(equal(rb, compare_result, lb, le));
+    compare_result = set_union(par, sb, se, lb, le, rb, greater());
+    assert(equal(rb, compare_result, lb, le));
+
+    // === First range and second range are completely disjoint ===
+    fill(sb, se, 2UL);
+    // All of the elements of the first range precede all of the elements of the second range
+    compare_result = set_union(par, lb, le, sb, se, rb);
+    assert(equal(rb, rb + static_cast<int>(testSize), lb, le));
+    assert(equal(rb + static_cast<int>(testSize), compare_result, sb, se));
+    compare_result = set_union(par, sb, se, lb, le, rb);
+    assert(equal(rb, rb + static_cast<int>(testSize), lb, le));
+    assert(equal(rb + static_cast<int>(testSize), compare_result, sb, se));
+
+    // All of the elements of the first range follow all of the elements of the second range
+    compare_result = set_union(par, sb, se, lb, le, rb, greater());
+    assert(equal(rb, rb + shortListSize, sb, se));
+    assert(equal(rb + shortListSize, compare_result, lb, le));
+    compare_result = set_union(par, lb, le, sb, se, rb, greater());
+    assert(equal(rb, rb + shortListSize, sb, se));
+    assert(equal(rb + shortListSize, compare_result, lb, le));
+
+    // === Increasing lists ===
+    // Increasing lists starting at 1, with shortList a subset of longList
+    iota(lb, le, 1UL);
+    iota(sb, se, 1UL);
+    compare_result = set_union(par, lb, le, sb, se, rb);
+    assert(equal(rb, compare_result, lb, le));
+    compare_result = set_union(par, sb, se, lb, le, rb);
+    assert(equal(rb, compare_result, lb, le));
+
+    // shortList is a subset of longList, containing every other element of longList
+    size_t curr = 2;
+    for (auto& elem : shortList) {
+        elem = curr;
+        curr += 2;
+    }
+    compare_result = set_union(par, lb, le, sb, se, rb);
+    assert(equal(rb, compare_result, lb, le));
+    compare_result = set_union(par, sb, se, lb, le, rb);
+    assert(equal(rb, compare_result, lb, le));
+
+    // shortList and the odd elements of longList interleave
+    for (auto& elem : longList) {
+        elem = elem * 2 - 1;
+    }
+    vector<size_t> expected(longList.size() + shortList.size());
+    merge(lb, le, sb, se, expected.begin());
+    compare_result = set_union(par, lb, le, sb, se, rb);
+    assert(equal(rb, compare_result, expected.begin(), expected.end()));
+    compare_result = set_union(par, sb, se, lb, le, rb);
+    assert(equal(rb, compare_result, expected.begin(), expected.end()));
+
+    // === Decreasing lists ===
+    reverse(lb, le);
+    reverse(sb, se);
+    reverse(expected.begin(), expected.end());
+    compare_result = set_union(par, lb, le, sb, se, rb, greater());
+    assert(equal(rb, compare_result, expected.begin(), expected.end()));
+    compare_result = set_union(par, sb, se, lb, le, rb, greater());
+    assert(equal(rb, compare_result, expected.begin(), expected.end()));
+
+    // test randomized input ranges
+    const auto seedValue = random_device{}();
+    mt19937 gen(seedValue);
+    uniform_int_distribution<> dis(0, static_cast<int>(testSize));
+
+    vector<int> list1(testSize);
+    vector<int> list2(testSize);
+    vector<int> seqRes(testSize * 2);
+    vector<int> parRes(testSize * 2);
+
+    for (auto& elem : list1) {
+        elem = dis(gen);
+    }
+    for (auto& elem : list2) {
+        elem = dis(gen);
+    }
+
+    sort(list1.begin(), list1.end());
+    sort(list2.begin(), list2.end());
+    auto seqComp = set_union(list1.begin(), list1.end(), list2.begin(), list2.end(), seqRes.begin());
+    auto parComp = set_union(par, list1.begin(), list1.end(), list2.begin(), list2.end(), parRes.begin());
+    assert_message_vector(
+        equal(seqRes.begin(), seqComp, parRes.begin(), parComp), "Randomized vectors, set union 1", seedValue);
+
+    // shorten the second range so that its elements are spread across fewer chunks of the first range
+    const auto list2Mid = list2.begin() + static_cast<int>(testSize / 3);
+    seqComp             = set_union(list1.begin(), list1.end(), list2.begin(), list2Mid, seqRes.begin());
+    parComp             = set_union(par, list1.begin(), list1.end(), list2.begin(), list2Mid, parRes.begin());
+    assert_message_vector(
+        equal(seqRes.begin(), seqComp, parRes.begin(), parComp), "Randomized vectors, set union 2", seedValue);
+}
+
+int main() {
+    parallel_test_case(test_case_set_union_parallel);
+}
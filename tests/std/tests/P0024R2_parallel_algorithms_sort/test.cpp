@@ -4,8 +4,11 @@
 #include <algorithm>
 #include <assert.h>
 #include <execution>
+#include <functional>
+#include <limits>
 #include <numeric>
 #include <random>
+#include <type_traits>
 #include <vector>
 
 #include <parallel_algorithms_utilities.hpp>
@@ -35,9 +38,66 @@ void test_case_sort_parallel(const size_t testSize, mt19937& gen) {
     assert(is_sorted(c.begin(), c.end()));
 }
 
+void test_case_sort_parallel_large(mt19937& gen) {
+    // large enough that the top levels of the quicksort partition on the thread pool
+    for (const size_t distinctValues : {size_t{1}, size_t{3}, size_t{1000}, size_t{1} << 30}) {
+        vector<size_t> c(300'000);
+        uniform_int_distribution<size_t> dist(static_cast<size_t>(0), distinctValues - 1);
+        generate(c.begin(), c.end(), [&] { return dist(gen); });
+        auto expected = c;
+        sort(expected.begin(), expected.end());
+        sort(par, c.begin(), c.end());
+        assert(c == expected);
+        sort(par, c.begin(), c.end(), greater<>{});
+        assert(is_sorted(c.begin(), c.end(), greater<>{}));
+    }
+}
+
+template <class T, class Pred>
+void test_case_sort_parallel_arithmetic(mt19937& gen, Pred pred) {
+    // contiguous arithmetic ranges sorted by less or greater are radix sorted
+    for (const size_t testSize : {size_t{1000}, size_t{300'000}}) {
+        vector<T> c(testSize);
+        uniform_int_distribution<int> dist(-1'000'000, 1'000'000);
+        generate(c.begin(), c.end(), [&] { return static_cast<T>(dist(gen)); });
+        if constexpr (is_floating_point_v<T>) {
+            c[0] = T{-0.0};
+            c[1] = numeric_limits<T>::infinity();
+            c[2] = -numeric_limits<T>::infinity();
+            c[3] = numeric_limits<T>::lowest();
+            c[4] = numeric_limits<T>::denorm_min();
+        } else {
+            c[0] = (numeric_limits<T>::min)();
+            c[1] = (numeric_limits<T>::max)();
+        }
+
+        auto expected = c;
+        sort(expected.begin(), expected.end(), pred);
+        sort(par, c.begin(), c.end(), pred);
+        assert(c == expected); // -0.0 and 0.0 may be in either order, but compare equal
+    }
+}
+
+template <class T>
+void test_case_sort_parallel_arithmetic(mt19937& gen) {
+    test_case_sort_parallel_arithmetic<T>(gen, less<>{});
+    test_case_sort_parallel_arithmetic<T>(gen, less<T>{});
+    test_case_sort_parallel_arithmetic<T>(gen, greater<>{});
+    test_case_sort_parallel_arithmetic<T>(gen, greater<T>{});
+}
+
 int main() {
     mt19937 gen(1729);
 
     test_case_sort_parallel_special_cases();
     parallel_test_case(test_case_sort_parallel, gen);
+    test_case_sort_parallel_large(gen);
+    test_case_sort_parallel_arithmetic<signed char>(gen);
+    test_case_sort_parallel_arithmetic<unsigned short>(gen);
+    test_case_sort_parallel_arithmetic<int>(gen);
+    test_case_sort_parallel_arithmetic<unsigned int>(gen);
+    test_case_sort_parallel_arithmetic<long long>(gen);
+    test_case_sort_parallel_arithmetic<unsigned long long>(gen);
+    test_case_sort_parallel_arithmetic<float>(gen);
+    test_case_sort_parallel_arithmetic<double>(gen);
 }
@@ -0,0 +1,91 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <assert.h>
+#include <execution>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include <parallel_algorithms_utilities.hpp>
+
+using namespace std;
+using namespace std::execution;
+
+struct movable_uint {
+    unsigned int value;
+    /* implicit */ operator unsigned int() const {
+        return value;
+    }
+
+    movable_uint() : value{} {}
+    /* implicit */ movable_uint(unsigned int x) : value(x) {}
+    movable_uint(const movable_uint&) = delete;
+    movable_uint(movable_uint&&)      = default;
+    movable_uint& operator=(const movable_uint&) = delete;
+    movable_uint& operator=(movable_uint&&) = default;
+};
+
+const auto is_even = [](unsigned int i) { return (i & 0x1u) == 0; };
+
+template <template <class...> class Container>
+void test_case_stable_partition_parallel(const size_t testSize, mt19937& gen) {
+    Container<unsigned int> tmp(testSize);
+    iota(tmp.begin(), tmp.end(), 0U);
+
+    auto tmpStart = tmp;
+    {
+        assert(tmp.end() == stable_partition(par, tmp.begin(), tmp.end(), [](auto) { return true; }));
+        assert(tmp == tmpStart);
+        assert(tmp.begin() == stable_partition(par, tmp.begin(), tmp.end(), [](auto) { return false; }));
+        assert(tmp == tmpStart);
+
+        const auto result         = stable_partition(par, tmp.begin(), tmp.end(), is_even);
+        const auto expectedFalses = testSize >> 1;
+        const auto expectedTrues  = testSize - expectedFalses;
+        assert(distance(tmp.begin(), result) == static_cast<ptrdiff_t>(expectedTrues));
+        assert(distance(result, tmp.end()) == static_cast<ptrdiff_t>(expectedFalses));
+        unsigned int expected = 0;
+        for (auto it = tmp.begin(); it != result; ++it, expected += 2) {
+            assert(*it == expected);
+        }
+
+        expected = 1;
+        for (auto it = result; it != tmp.end(); ++it, expected += 2) {
+            assert(*it == expected);
+        }
+    }
+
+    // "fuzz" testing:
+    for (int i = 0; i < 100; ++i) {
+        generate(tmp.begin(), tmp.end(), ref(gen));
+        tmpStart            = tmp;
+        auto serialResult   = stable_partition(tmpStart.begin(), tmpStart.end(), is_even);
+        auto parallelResult = stable_partition(par, tmp.begin(), tmp.end(), is_even);
+        assert(distance(tmp.begin(), parallelResult) == distance(tmpStart.begin(), serialResult));
+        assert(tmp == tmpStart);
+    }
+}
+
+void test_case_move_only_elements() {
+    vector<movable_uint> tmp(10);
+    iota(tmp.begin(), tmp.end(), 0U);
+    auto result = stable_partition(par, tmp.begin(), tmp.end(), is_even);
+    assert(result - tmp.begin() == 5);
+    for (unsigned int i = 0; i < 5; ++i) {
+        assert(tmp[i] == i * 2);
+        assert(tmp[i + 5] == i * 2 + 1);
+    }
+}
+
+int main() {
+    mt19937 gen(1729);
+    parallel_test_case(test_case_stable_partition_parallel<list>, gen);
+    parallel_test_case(test_case_stable_partition_parallel<vector>, gen);
+
+    test_case_move_only_elements();
+}
@@ -27,6 +27,11 @@ void test_case_unary_transform_parallel(const size_t testSize, mt19937& gen) {
     DestContainer<unsigned int> d(testSize);
     assert(d.end() == transform(par, s.cbegin(), s.cend(), d.begin(), add_twenty));
     assert(equal(s.cbegin(), s.cend(), d.cbegin(), d.cend(), equal_twenty));
+#if _HAS_CXX20
+    fill(d.begin(), d.end(), 0U);
+    assert(d.end() == transform(unseq, s.cbegin(), s.cend(), d.begin(), add_twenty));
+    assert(equal(s.cbegin(), s.cend(), d.cbegin(), d.cend(), equal_twenty));
+#endif // _HAS_CXX20
 }
 
 template <template <class...> class Source1Container, template <class...> class Source2Container,
@@ -41,6 +46,11 @@ void test_case_binary_transform_parallel(const size_t testSize, mt19937& gen) {
     DestContainer<unsigned int> d(testSize);
     assert(d.end() == transform(par, s1.cbegin(), s1.cend(), s2.cbegin(), d.begin(), plus<>{}));
     assert(equal(expected.begin(), expected.end(), d.begin(), d.end()));
+#if _HAS_CXX20
+    fill(d.begin(), d.end(), 0U);
+    assert(d.end() == transform(unseq, s1.cbegin(), s1.cend(), s2.cbegin(), d.begin(), plus<>{}));
+    assert(equal(expected.begin(), expected.end(), d.begin(), d.end()));
+#endif // _HAS_CXX20
 }
 
 int main() {
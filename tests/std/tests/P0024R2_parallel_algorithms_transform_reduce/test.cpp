@@ -61,12 +61,20 @@ void test_case_transform_reduce(const size_t testSize, mt19937& gen) {
     assert(correct == transform_reduce(b, e, 0U, plus<>{}, times_ten));
     assert(correct == transform_reduce(seq, b, e, 0U, plus<>{}, times_ten));
     assert(correct == transform_reduce(par, b, e, 0U, plus<>{}, times_ten));
+    assert(correct == transform_reduce(par_unseq, b, e, 0U, plus<>{}, times_ten));
+#if _HAS_CXX20
+    assert(correct == transform_reduce(unseq, b, e, 0U, plus<>{}, times_ten));
+#endif // _HAS_CXX20
 
     correct += 42U;
 
     assert(correct == transform_reduce(b, e, 42U, plus<>{}, times_ten));
     assert(correct == transform_reduce(seq, b, e, 42U, plus<>{}, times_ten));
     assert(correct == transform_reduce(par, b, e, 42U, plus<>{}, times_ten));
+    assert(correct == transform_reduce(par_unseq, b, e, 42U, plus<>{}, times_ten));
+#if _HAS_CXX20
+    assert(correct == transform_reduce(unseq, b, e, 42U, plus<>{}, times_ten));
+#endif // _HAS_CXX20
 }
 
 vector<unique_ptr<vector<unsigned int>>> get_move_only_test_data(const size_t testSize) {
@@ -0,0 +1,149 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <assert.h>
+#include <atomic>
+#include <execution>
+#include <forward_list>
+#include <list>
+#include <memory>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+#include <parallel_algorithms_utilities.hpp>
+
+using namespace std;
+using namespace std::execution;
+
+atomic<int> g_live{0};
+
+struct counted {
+    int value;
+
+    counted() : value(-1) {
+        ++g_live;
+    }
+    counted(const int x) : value(x) {
+        ++g_live;
+    }
+    counted(const counted& other) : value(other.value) {
+        ++g_live;
+    }
+    counted(counted&& other) noexcept : value(other.value) {
+        other.value = -2;
+        ++g_live;
+    }
+    ~counted() {
+        --g_live;
+    }
+};
+
+template <class T>
+struct raw_buffer {
+    allocator<T> alloc;
+    size_t count;
+    T* ptr;
+
+    explicit raw_buffer(const size_t n) : count(n), ptr(alloc.allocate(n == 0 ? 1 : n)) {}
+    raw_buffer(const raw_buffer&) = delete;
+    raw_buffer& operator=(const raw_buffer&) = delete;
+    ~raw_buffer() {
+        alloc.deallocate(ptr, count == 0 ? 1 : count);
+    }
+
+    T* begin() const {
+        return ptr;
+    }
+    T* end() const {
+        return ptr + count;
+    }
+};
+
+template <template <class...> class Container>
+struct test_case_uninitialized_copy_move_parallel {
+    template <typename ExecutionPolicy>
+    void operator()(const size_t testSize, const ExecutionPolicy& exec) {
+        Container<counted> c;
+        for (size_t i = 0; i < testSize; ++i) {
+            c.emplace_front(static_cast<int>(i));
+        }
+
+        const int liveBefore = g_live.load();
+        raw_buffer<counted> copied(testSize);
+        assert(uninitialized_copy(exec, c.begin(), c.end(), copied.begin()) == copied.end());
+        assert(equal(c.begin(), c.end(), copied.begin(),
+            [](const counted& lhs, const counted& rhs) { return lhs.value == rhs.value; }));
+        assert(g_live == liveBefore + static_cast<int>(testSize));
+        destroy(exec, copied.begin(), copied.end());
+        assert(g_live == liveBefore);
+
+        assert(uninitialized_copy_n(exec, c.begin(), testSize, copied.begin()) == copied.end());
+        assert(equal(c.begin(), c.end(), copied.begin(),
+            [](const counted& lhs, const counted& rhs) { return lhs.value == rhs.value; }));
+
+        raw_buffer<counted> moved(testSize);
+        assert(uninitialized_move(exec, copied.begin(), copied.end(), moved.begin()) == moved.end());
+        assert(equal(c.begin(), c.end(), moved.begin(),
+            [](const counted& lhs, const counted& rhs) { return lhs.value == rhs.value; }));
+        assert(all_of(copied.begin(), copied.end(), [](const counted& x) { return x.value == -2; }));
+        assert(destroy_n(exec, copied.begin(), testSize) == copied.end());
+
+        const auto result = uninitialized_move_n(exec, moved.begin(), testSize, copied.begin());
+        assert(result.first == moved.end());
+        assert(result.second == copied.end());
+        assert(equal(c.begin(), c.end(), copied.begin(),
+            [](const counted& lhs, const counted& rhs) { return lhs.value == rhs.value; }));
+        destroy(exec, moved.begin(), moved.end());
+        destroy(exec, copied.begin(), copied.end());
+        assert(g_live == liveBefore);
+    }
+};
+
+struct test_case_uninitialized_construct_parallel {
+    template <typename ExecutionPolicy>
+    void operator()(const size_t testSize, const ExecutionPolicy& exec) {
+        raw_buffer<counted> buf(testSize);
+        uninitialized_default_construct(exec, buf.begin(), buf.end());
+        assert(all_of(buf.begin(), buf.end(), [](const counted& x) { return x.value == -1; }));
+        assert(g_live == static_cast<int>(testSize));
+        destroy(exec, buf.begin(), buf.end());
+        assert(g_live == 0);
+
+        assert(uninitialized_value_construct_n(exec, buf.begin(), testSize) == buf.end());
+        assert(all_of(buf.begin(), buf.end(), [](const counted& x) { return x.value == -1; }));
+        assert(destroy_n(exec, buf.begin(), testSize) == buf.end());
+
+        uninitialized_fill(exec, buf.begin(), buf.end(), counted{42});
+        assert(all_of(buf.begin(), buf.end(), [](const counted& x) { return x.value == 42; }));
+        destroy(exec, buf.begin(), buf.end());
+
+        assert(uninitialized_fill_n(exec, buf.begin(), testSize, counted{1729}) == buf.end());
+        assert(all_of(buf.begin(), buf.end(), [](const counted& x) { return x.value == 1729; }));
+        destroy(exec, buf.begin(), buf.end());
+        assert(g_live == 0);
+
+        raw_buffer<int> ints(testSize);
+        uninitialized_fill(exec, ints.begin(), ints.end(), 0x5A5A5A5A);
+        assert(all_of(ints.begin(), ints.end(), [](const int x) { return x == 0x5A5A5A5A; }));
+        uninitialized_value_construct(exec, ints.begin(), ints.end());
+        assert(all_of(ints.begin(), ints.end(), [](const int x) { return x == 0; }));
+        assert(uninitialized_default_construct_n(exec, ints.begin(), testSize) == ints.end());
+
+        vector<int> source(testSize);
+        iota(source.begin(), source.end(), 0);
+        assert(uninitialized_copy(exec, source.begin(), source.end(), ints.begin()) == ints.end());
+        assert(equal(source.begin(), source.end(), ints.begin()));
+        assert(destroy_n(exec, ints.begin(), testSize) == ints.end());
+    }
+};
+
+int main() {
+    parallel_test_case(test_case_uninitialized_copy_move_parallel<forward_list>{}, seq);
+    parallel_test_case(test_case_uninitialized_copy_move_parallel<forward_list>{}, par);
+    parallel_test_case(test_case_uninitialized_copy_move_parallel<list>{}, par);
+    parallel_test_case(test_case_uninitialized_construct_parallel{}, seq);
+    parallel_test_case(test_case_uninitialized_construct_parallel{}, par);
+    parallel_test_case(test_case_uninitialized_construct_parallel{}, par_unseq);
+}
@@ -0,0 +1,109 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <assert.h>
+#include <execution>
+#include <forward_list>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include <parallel_algorithms_utilities.hpp>
+
+using namespace std;
+using namespace std::execution;
+
+struct movable_uint {
+    unsigned int value;
+    /* implicit */ operator unsigned int() const {
+        return value;
+    }
+
+    movable_uint() : value{} {}
+    /* implicit */ movable_uint(unsigned int x) : value(x) {}
+    movable_uint(const movable_uint&) = delete;
+    movable_uint(movable_uint&&)      = default;
+    movable_uint& operator=(const movable_uint&) = delete;
+    movable_uint& operator=(movable_uint&&) = default;
+};
+
+const auto same_parity = [](unsigned int a, unsigned int b) { return ((a ^ b) & 0x1u) == 0; };
+
+template <template <class...> class Container>
+void test_case_unique_parallel(const size_t testSize, mt19937& gen) {
+    Container<unsigned int> tmp(testSize);
+    iota(tmp.begin(), tmp.end(), 0U);
+    Container<unsigned int> tested(tmp);
+
+    {
+        // remove nothing:
+        assert(tested.end() == unique(par, tested.begin(), tested.end()));
+        assert(tmp == tested);
+        assert(tested.end() == unique(par, tested.begin(), tested.end(), same_parity));
+        assert(tmp == tested);
+
+        // remove everything but the first element:
+        fill(tested.begin(), tested.end(), 42U);
+        const auto result = unique(par, tested.begin(), tested.end());
+        if (testSize == 0) {
+            assert(result == tested.end());
+        } else {
+            assert(next(tested.begin()) == result);
+            assert(*tested.begin() == 42U);
+        }
+    }
+
+    // "fuzz" testing, with runs of equal elements of random lengths:
+    uniform_int_distribution<unsigned int> runLength(1, 4);
+    for (int i = 0; i < 100; ++i) {
+        unsigned int value     = 0;
+        unsigned int remaining = 0;
+        for (auto& elem : tmp) {
+            if (remaining == 0) {
+                value     = static_cast<unsigned int>(gen());
+                remaining = runLength(gen);
+            }
+
+            elem = value;
+            --remaining;
+        }
+
+        tested              = tmp;
+        auto serialResult   = unique(tmp.begin(), tmp.end());
+        auto parallelResult = unique(par, tested.begin(), tested.end());
+        assert(equal(tmp.begin(), serialResult, tested.begin(), parallelResult));
+
+        generate(tmp.begin(), tmp.end(), ref(gen));
+        tested         = tmp;
+        serialResult   = unique(tmp.begin(), tmp.end(), same_parity);
+        parallelResult = unique(par, tested.begin(), tested.end(), same_parity);
+        assert(equal(tmp.begin(), serialResult, tested.begin(), parallelResult));
+    }
+}
+
+void test_case_move_only_elements() {
+    vector<movable_uint> tmp(10);
+    iota(tmp.begin(), tmp.end(), 0U);
+    for (auto& elem : tmp) {
+        elem = elem / 3;
+    }
+
+    auto result = unique(par, tmp.begin(), tmp.end());
+    assert(result - tmp.begin() == 4);
+    for (unsigned int i = 0; i < 4; ++i) {
+        assert(tmp[i] == i);
+    }
+}
+
+int main() {
+    mt19937 gen(1729);
+    parallel_test_case(test_case_unique_parallel<forward_list>, gen);
+    parallel_test_case(test_case_unique_parallel<list>, gen);
+    parallel_test_case(test_case_unique_parallel<vector>, gen);
+
+    test_case_move_only_elements();
+}
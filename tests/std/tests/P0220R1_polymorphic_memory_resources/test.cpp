@@ -24,6 +24,10 @@
 #include <unordered_set>
 #include <vector>
 
+#ifndef _M_CEE
+#include <thread>
+#endif // _M_CEE
+
 #pragma warning(disable : 6326) // Potential comparison of a constant with another constant.
 #pragma warning(disable : 28251) // Inconsistent annotation for 'new': this instance has no annotations.
 
@@ -1052,6 +1056,79 @@ namespace {
                 }
             } // namespace release
 
+            namespace rewind {
+                void test() {
+                    // Verify that rewinding to a mark returns buffers obtained since the mark upstream, and that
+                    // allocation resumes from the marked position
+                    recording_resource rr;
+                    std::pmr::monotonic_buffer_resource mbr{256_zu, &rr};
+
+                    (void) mbr.allocate(sizeof(void*), alignof(void*));
+                    auto const baseline = rr.allocations_.size();
+                    auto const outer    = stdext::pmr::mark(mbr);
+                    void* const first   = mbr.allocate(sizeof(void*), alignof(void*));
+
+                    for (int i = 0; i < 64; ++i) {
+                        (void) mbr.allocate(100, alignof(void*));
+                    }
+                    CHECK(rr.allocations_.size() > baseline);
+
+                    auto const inner = stdext::pmr::mark(mbr);
+                    for (int i = 0; i < 64; ++i) {
+                        (void) mbr.allocate(100, alignof(void*));
+                    }
+                    stdext::pmr::rewind(mbr, inner);
+
+                    stdext::pmr::rewind(mbr, outer);
+                    CHECK(rr.allocations_.size() == baseline);
+                    CHECK(mbr.allocate(sizeof(void*), alignof(void*)) == first);
+
+                    {
+                        // marks work with an initial buffer too
+                        alignas(void*) char buffer[64 * sizeof(void*)];
+                        std::pmr::monotonic_buffer_resource buffered{buffer, sizeof(buffer), &rr};
+                        auto const start = stdext::pmr::mark(buffered);
+                        void* const ptr  = buffered.allocate(sizeof(void*), alignof(void*));
+                        CHECK(ptr == buffer);
+                        (void) buffered.allocate(sizeof(buffer), alignof(void*));
+                        CHECK(rr.allocations_.size() == baseline + 1);
+                        stdext::pmr::rewind(buffered, start);
+                        CHECK(rr.allocations_.size() == baseline);
+                        CHECK(buffered.allocate(sizeof(void*), alignof(void*)) == buffer);
+                    }
+                }
+            } // namespace rewind
+
+            namespace release_retaining_largest_buffer {
+                void test() {
+                    // Verify that release_retaining_largest_buffer keeps exactly the largest upstream buffer, and
+                    // that later allocations reuse it instead of going upstream
+                    recording_resource rr;
+                    std::pmr::monotonic_buffer_resource mbr{&rr};
+
+                    for (int i = 0; i < 256; ++i) {
+                        (void) mbr.allocate(100, alignof(void*));
+                    }
+                    CHECK(rr.allocations_.size() > 1);
+                    auto const largest = std::max_element(rr.allocations_.begin(), rr.allocations_.end(),
+                        [](auto const& x, auto const& y) { return x.size < y.size; })->size;
+
+                    for (int request = 0; request < 16; ++request) {
+                        stdext::pmr::release_retaining_largest_buffer(mbr);
+                        CHECK(rr.allocations_.size() == 1);
+                        CHECK(rr.allocations_.front().size == largest);
+
+                        for (auto used = 0_zu; used + 2 * sizeof(void*) < largest / 2; used += sizeof(void*)) {
+                            (void) mbr.allocate(sizeof(void*), alignof(void*));
+                        }
+                        CHECK(rr.allocations_.size() == 1);
+                    }
+
+                    mbr.release();
+                    CHECK(rr.allocations_.empty());
+                }
+            } // namespace release_retaining_largest_buffer
+
             namespace do_allocate {
                 void test_preallocated_buffer() {
                     // Verify that calls to allocate do not hit the upstream resource until the
@@ -1289,11 +1366,69 @@ namespace {
                 analyze_geometric_growth(sizes.data(), sizes.size());
             }
 
+#ifndef _M_CEE
+            void test_synchronized_threads() {
+                // allocate on several threads, then deallocate each block on a different thread than allocated it
+                static constexpr auto n_threads = 8_zu;
+                static constexpr auto n_allocs  = 4096_zu;
+
+                std::pmr::synchronized_pool_resource spr{{0_zu, 1_zu << 16}, std::pmr::new_delete_resource()};
+                std::vector<std::vector<std::pair<unsigned char*, std::size_t>>> blocks(n_threads);
+                std::vector<std::thread> threads;
+
+                for (auto t = 0_zu; t < n_threads; ++t) {
+                    threads.emplace_back([&spr, &mine = blocks[t], t] {
+                        for (auto i = 0_zu; i < n_allocs; ++i) {
+                            auto const size = 1_zu << (i % 14); // both cached and uncached block sizes
+                            auto const ptr  = static_cast<unsigned char*>(spr.allocate(size, alignof(void*)));
+                            std::fill_n(ptr, size, static_cast<unsigned char>(t));
+                            mine.emplace_back(ptr, size);
+                            if (i % 3 == 0) { // also free some blocks while other threads are allocating
+                                auto const [old_ptr, old_size] = mine[i / 2];
+                                CHECK(std::count(old_ptr, old_ptr + old_size, static_cast<unsigned char>(t))
+                                      == static_cast<std::ptrdiff_t>(old_size));
+                                spr.deallocate(old_ptr, old_size, alignof(void*));
+                                mine[i / 2].first = nullptr;
+                            }
+                        }
+                    });
+                }
+
+                for (auto& thread : threads) {
+                    thread.join();
+                }
+                threads.clear();
+
+                for (auto t = 0_zu; t < n_threads; ++t) {
+                    threads.emplace_back([&spr, &theirs = blocks[(t + 1) % n_threads], owner = (t + 1) % n_threads] {
+                        for (auto const& [ptr, size] : theirs) {
+                            if (ptr) {
+                                CHECK(std::count(ptr, ptr + size, static_cast<unsigned char>(owner))
+                                      == static_cast<std::ptrdiff_t>(size));
+                                spr.deallocate(ptr, size, alignof(void*));
+                            }
+                        }
+                    });
+                }
+
+                for (auto& thread : threads) {
+                    thread.join();
+                }
+
+                spr.release();
+                auto const ptr = spr.allocate(32, alignof(void*));
+                spr.deallocate(ptr, 32, alignof(void*));
+            }
+#endif // _M_CEE
+
             void test() {
                 test_light_allocation();
                 test_medium_allocation();
                 test_heavy_allocation();
                 test_growth();
+#ifndef _M_CEE
+                test_synchronized_threads();
+#endif // _M_CEE
             }
         } // namespace allocate_deallocate
 
@@ -1481,6 +1616,8 @@ int main() {
     monotonic::ctor::size_upstream::test();
     monotonic::ctor::upstream::test();
     monotonic::mem::release::test();
+    monotonic::mem::rewind::test();
+    monotonic::mem::release_retaining_largest_buffer::test();
     monotonic::mem::do_allocate::test();
     monotonic::mem::do_deallocate::test();
 
@@ -0,0 +1,86 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <assert.h>
+#include <iterator>
+#include <memory_resource>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+using namespace std;
+
+class counting_resource : public pmr::memory_resource { // counts the bytes outstanding from new_delete_resource
+public:
+    size_t outstanding = 0;
+
+private:
+    void* do_allocate(const size_t bytes, const size_t align) override {
+        void* const ptr = pmr::new_delete_resource()->allocate(bytes, align);
+        outstanding += bytes;
+        return ptr;
+    }
+
+    void do_deallocate(void* const ptr, const size_t bytes, const size_t align) override {
+        assert(outstanding >= bytes);
+        outstanding -= bytes;
+        pmr::new_delete_resource()->deallocate(ptr, bytes, align);
+    }
+
+    bool do_is_equal(const pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+};
+
+struct request {
+    size_t bytes;
+    size_t align;
+};
+
+// the alignment of the last two requests needs pools for blocks larger than largest_required_pool_block
+constexpr request requests[] = {{1, 1}, {8, 8}, {24, 8}, {100, 16}, {256, 64}, {8, 1024}, {1, 4096}};
+
+template <class PoolResource>
+void test_pool_resource() {
+    counting_resource upstream;
+    {
+        PoolResource pool{pmr::pool_options{0, 256}, &upstream};
+        assert(pool.options().largest_required_pool_block == 256);
+        for (int round = 0; round < 3; ++round) {
+            void* blocks[size(requests)][4];
+            for (size_t i = 0; i < size(requests); ++i) {
+                for (auto& block : blocks[i]) {
+                    block = pool.allocate(requests[i].bytes, requests[i].align);
+                    assert(reinterpret_cast<uintptr_t>(block) % requests[i].align == 0);
+                    memset(block, static_cast<int>(i), requests[i].bytes);
+                }
+            }
+
+            for (size_t i = 0; i < size(requests); ++i) {
+                for (const auto block : blocks[i]) {
+                    assert(*static_cast<unsigned char*>(block) == i);
+                    pool.deallocate(block, requests[i].bytes, requests[i].align);
+                }
+            }
+
+            if (round == 1) {
+                pool.release();
+                assert(upstream.outstanding == 0);
+            }
+        }
+
+        // the pools are recreated after release()
+        pool.release();
+        assert(upstream.outstanding == 0);
+        void* const block = pool.allocate(8, 2048);
+        assert(reinterpret_cast<uintptr_t>(block) % 2048 == 0);
+        pool.deallocate(block, 8, 2048);
+    }
+
+    assert(upstream.outstanding == 0);
+}
+
+int main() {
+    test_pool_resource<pmr::unsynchronized_pool_resource>();
+    test_pool_resource<pmr::synchronized_pool_resource>();
+}
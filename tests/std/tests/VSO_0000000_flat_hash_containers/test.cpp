@@ -0,0 +1,270 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <assert.h>
+#include <flat_hash_map>
+#include <flat_hash_set>
+#include <stddef.h>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+
+using namespace std;
+using stdext::flat_hash_map;
+using stdext::flat_hash_set;
+
+static int g_alive = 0;
+
+struct counted_string {
+    string str;
+
+    counted_string() {
+        ++g_alive;
+    }
+    /* implicit */ counted_string(const char* const s) : str(s) {
+        ++g_alive;
+    }
+    counted_string(const counted_string& other) : str(other.str) {
+        ++g_alive;
+    }
+    counted_string(counted_string&& other) noexcept : str(move(other.str)) {
+        ++g_alive;
+    }
+    counted_string& operator=(const counted_string&) = default;
+    counted_string& operator=(counted_string&&) = default;
+    ~counted_string() {
+        --g_alive;
+    }
+
+    friend bool operator==(const counted_string& lhs, const counted_string& rhs) {
+        return lhs.str == rhs.str;
+    }
+};
+
+struct identity_hash { // adjacent keys differ only in their low bits, which the table must spread
+    size_t operator()(const int i) const noexcept {
+        return static_cast<size_t>(i);
+    }
+};
+
+template <class Map, class Reference>
+void assert_same(const Map& m, const Reference& ref) {
+    assert(m.size() == ref.size());
+    assert(m.empty() == ref.empty());
+    size_t n = 0;
+    for (const auto& [key, value] : m) {
+        const auto found = ref.find(key);
+        assert(found != ref.end());
+        assert(found->second == value);
+        ++n;
+    }
+
+    assert(n == ref.size());
+    for (const auto& [key, value] : ref) {
+        const auto found = m.find(key);
+        assert(found != m.end());
+        assert(found->second == value);
+    }
+}
+
+void test_basic_operations() {
+    flat_hash_map<int, int> m;
+    assert(m.empty());
+    assert(m.begin() == m.end());
+    assert(m.find(0) == m.end());
+    assert(m.bucket_count() == 0);
+
+    const auto [where, inserted] = m.emplace(1, 10);
+    assert(inserted);
+    assert(where->first == 1 && where->second == 10);
+    assert(!m.emplace(1, 20).second);
+    assert(m.at(1) == 10);
+    assert(m.count(1) == 1);
+    assert(m.contains(1));
+    assert(!m.contains(2));
+
+    m[2] = 20;
+    assert(m.size() == 2);
+    assert(m.try_emplace(2, 30).first->second == 20);
+    assert(!m.insert_or_assign(2, 40).second);
+    assert(m.at(2) == 40);
+    assert(m.insert_or_assign(3, 30).second);
+
+    const auto range = m.equal_range(3);
+    assert(range.first != m.end() && range.first->second == 30);
+    assert(next(range.first) == range.second);
+
+    try {
+        (void) m.at(4);
+        assert(false);
+    } catch (const out_of_range&) {
+    }
+
+    assert(m.erase(3) == 1);
+    assert(m.erase(3) == 0);
+    assert(m.size() == 2);
+    assert(m.load_factor() > 0.0f && m.load_factor() <= m.max_load_factor());
+
+    m.clear();
+    assert(m.empty());
+    assert(m.begin() == m.end());
+    assert(m.bucket_count() != 0);
+}
+
+void test_against_unordered_map() {
+    // mixed insertions and erasures leave deleted slots behind, which lookups must still probe past
+    flat_hash_map<int, int, identity_hash> m;
+    unordered_map<int, int> ref;
+    unsigned int state = 1729;
+    for (int i = 0; i < 20000; ++i) {
+        state         = state * 1103515245U + 12345U;
+        const int key = static_cast<int>((state >> 16) % 2000U);
+        switch (state % 4U) {
+        case 0:
+        case 1:
+            assert(m.emplace(key, i).second == ref.emplace(key, i).second);
+            break;
+        case 2:
+            assert(m.erase(key) == ref.erase(key));
+            break;
+        default:
+            {
+                const auto found = m.find(key);
+                if (found != m.end()) {
+                    assert(found->second == ref.at(key));
+                    m.erase(found);
+                    ref.erase(key);
+                }
+                break;
+            }
+        }
+    }
+
+    assert_same(m, ref);
+
+    // copies keep the layout, deleted slots included
+    const auto copied = m;
+    assert_same(copied, ref);
+    assert(copied == m);
+
+    flat_hash_map<int, int, identity_hash> assigned;
+    assigned = m;
+    assert_same(assigned, ref);
+
+    // rehashing drops deleted slots
+    m.rehash(0);
+    assert_same(m, ref);
+    m.reserve(10000);
+    assert(m.bucket_count() * m.max_load_factor() >= 10000);
+    assert_same(m, ref);
+
+    // erasing a range erases every element in it, even as deleted and empty slots are mixed in
+    auto first = m.begin();
+    for (size_t n = m.size() / 2; n != 0; --n) {
+        ++first;
+    }
+
+    for (auto i = first; i != m.end(); ++i) {
+        ref.erase(i->first);
+    }
+
+    assert(m.erase(first, m.end()) == m.end());
+    assert_same(m, ref);
+}
+
+void test_element_lifetimes() {
+    {
+        flat_hash_map<int, counted_string> m;
+        for (int i = 0; i < 1000; ++i) {
+            m.try_emplace(i, "meow");
+        }
+
+        assert(g_alive == 1000);
+        for (int i = 0; i < 1000; i += 2) {
+            m.erase(i);
+        }
+
+        assert(g_alive == 500);
+        flat_hash_map<int, counted_string> other = m;
+        assert(g_alive == 1000);
+        other = move(m);
+        assert(g_alive == 500);
+        assert(m.empty());
+        m.swap(other);
+        assert(other.empty());
+        assert(m.size() == 500);
+        m.clear();
+        assert(g_alive == 0);
+        m[5] = "purr";
+        assert(g_alive == 1);
+    }
+
+    assert(g_alive == 0);
+}
+
+void test_aliasing_insertion() {
+    // inserting an element's own value must work even when that insertion grows the table
+    flat_hash_map<int, counted_string> m;
+    m.try_emplace(0, "the quick brown fox jumps over the lazy dog");
+    for (int i = 1; i < 1000; ++i) {
+        m.try_emplace(i, m.at(i - 1));
+        assert(m.at(i) == m.at(0));
+    }
+}
+
+void test_sets() {
+    flat_hash_set<string> s{"cats", "dogs", "cats"};
+    assert(s.size() == 2);
+    assert(s.count("cats") == 1);
+    assert(s.contains("dogs"));
+    assert(!s.insert("dogs").second);
+    assert(s.insert("birds").second);
+
+    flat_hash_set<string> other{"dogs", "birds", "cats"};
+    assert(s == other);
+    other.erase("cats");
+    assert(s != other);
+    swap(s, other);
+    assert(s.size() == 2);
+    assert(other.size() == 3);
+
+    size_t n = 0;
+    for (const auto& str : other) {
+        assert(str == "cats" || str == "dogs" || str == "birds");
+        ++n;
+    }
+
+    assert(n == 3);
+}
+
+#if _HAS_CXX20
+struct transparent_string_hash {
+    using is_transparent = void;
+
+    size_t operator()(const string_view sv) const noexcept {
+        return hash<string_view>{}(sv);
+    }
+};
+
+void test_transparent_lookup() {
+    flat_hash_map<string, int, transparent_string_hash, equal_to<>> m;
+    m.emplace("kitten", 1);
+    const string_view key = "kitten";
+    assert(m.find(key) != m.end());
+    assert(m.contains(key));
+    assert(m.count("puppy") == 0);
+}
+#endif // _HAS_CXX20
+
+int main() {
+    test_basic_operations();
+    test_against_unordered_map();
+    test_element_lifetimes();
+    test_aliasing_insertion();
+    test_sets();
+#if _HAS_CXX20
+    test_transparent_lookup();
+#endif // _HAS_CXX20
+}
@@ -0,0 +1,183 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <assert.h>
+#include <iterator>
+#include <map>
+#include <stddef.h>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+
+using namespace std;
+
+struct identity_hash { // the split of each bucket is decided by a single bit of the key
+    size_t operator()(const int i) const noexcept {
+        return static_cast<size_t>(i);
+    }
+};
+
+bool is_power_of_2(const size_t n) {
+    return n != 0 && (n & (n - 1)) == 0;
+}
+
+template <class Container>
+void assert_buckets(const Container& c) {
+    assert(c.load_factor() <= c.max_load_factor());
+    size_t total = 0;
+    for (size_t b = 0; b < c.bucket_count(); ++b) {
+        size_t n = 0;
+        for (auto i = c.begin(b); i != c.end(b); ++i) {
+            assert(c.bucket(*i) == b);
+            ++n;
+        }
+
+        assert(n == c.bucket_size(b));
+        total += n;
+    }
+
+    assert(total == c.size());
+}
+
+template <class Container>
+void assert_map_buckets(const Container& c) {
+    assert(c.load_factor() <= c.max_load_factor());
+    size_t total = 0;
+    for (size_t b = 0; b < c.bucket_count(); ++b) {
+        for (auto i = c.begin(b); i != c.end(b); ++i) {
+            assert(c.bucket(i->first) == b);
+            ++total;
+        }
+    }
+
+    assert(total == c.size());
+}
+
+template <class Map>
+void assert_same(const Map& m, const map<int, int>& ref) {
+    assert(m.size() == ref.size());
+    for (const auto& p : ref) {
+        const auto found = m.find(p.first);
+        assert(found != m.end());
+        assert(found->second == p.second);
+    }
+}
+
+void test_growth() {
+    // each insertion that exceeds the load factor adds a single bucket
+    unordered_map<int, int, identity_hash> m;
+    map<int, int> ref;
+    bool saw_partial_round = false;
+    for (int i = 0; i < 5000; ++i) {
+        const size_t old_buckets = m.bucket_count();
+        const float new_load     = static_cast<float>(m.size() + 1) / static_cast<float>(old_buckets);
+        const bool needs_bucket  = m.max_load_factor() < new_load;
+        m.emplace(i * 7, i);
+        ref.emplace(i * 7, i);
+        assert(m.bucket_count() == (needs_bucket ? old_buckets + 1 : old_buckets));
+        saw_partial_round |= !is_power_of_2(m.bucket_count());
+        if (i % 251 == 0) {
+            assert_map_buckets(m);
+        }
+    }
+
+    assert(saw_partial_round);
+    assert_map_buckets(m);
+    assert_same(m, ref);
+
+    // erasures and lookups in both split and unsplit buckets
+    for (int i = 0; i < 5000; i += 3) {
+        assert(m.erase(i * 7) == 1);
+        ref.erase(i * 7);
+    }
+
+    assert_map_buckets(m);
+    assert_same(m, ref);
+
+    // copies and explicit rehashes must cope with a partially split table
+    const auto copied = m;
+    assert(copied == m);
+    assert_map_buckets(copied);
+
+    unordered_map<int, int, identity_hash> assigned;
+    assigned = m;
+    assert(assigned == m);
+    assert_map_buckets(assigned);
+
+    // moves and swaps take the partially copied bucket array for the next round along
+    unordered_map<int, int, identity_hash> moved(move(assigned));
+    assert(moved == m);
+    assigned.swap(moved);
+    assert(moved.empty());
+    for (int i = 5000; i < 7000; ++i) {
+        assigned.emplace(i * 7, i);
+        moved.emplace(i, i);
+    }
+
+    assert_map_buckets(assigned);
+    assert_map_buckets(moved);
+    moved = move(assigned);
+    assert_map_buckets(moved);
+    assert(moved.size() == m.size() + 2000);
+
+    m.rehash(m.bucket_count() + 1);
+    assert(is_power_of_2(m.bucket_count()));
+    assert_map_buckets(m);
+    assert_same(m, ref);
+
+    m.clear();
+    assert(m.empty());
+    for (int i = 0; i < 100; ++i) {
+        m.emplace(i, i);
+    }
+
+    assert_map_buckets(m);
+}
+
+void test_multi() {
+    // equivalent elements stay adjacent as their bucket is split
+    unordered_multiset<int, identity_hash> s;
+    for (int round = 0; round < 4; ++round) {
+        for (int i = 0; i < 1000; ++i) {
+            s.insert(i);
+            if (i % 97 == 0) {
+                assert_buckets(s);
+            }
+        }
+    }
+
+    assert_buckets(s);
+    assert(s.size() == 4000);
+    for (int i = 0; i < 1000; ++i) {
+        const auto range = s.equal_range(i);
+        assert(distance(range.first, range.second) == 4);
+        assert(s.count(i) == 4);
+    }
+}
+
+void test_small_load_factor() {
+    // a low max_load_factor needs several splits for a single insertion
+    unordered_set<int, identity_hash> s;
+    s.max_load_factor(0.25f);
+    for (int i = 0; i < 3000; ++i) {
+        assert(s.insert(i * 3).second);
+        assert(s.load_factor() <= s.max_load_factor());
+    }
+
+    assert_buckets(s);
+
+    // lowering the load factor further than the current doubling allows falls back to a full rehash
+    s.max_load_factor(0.01f);
+    s.insert(-1);
+    assert_buckets(s);
+    assert(s.size() == 3001);
+    for (int i = 0; i < 3000; ++i) {
+        assert(s.count(i * 3) == 1);
+    }
+}
+
+int main() {
+    test_growth();
+    test_multi();
+    test_small_load_factor();
+}
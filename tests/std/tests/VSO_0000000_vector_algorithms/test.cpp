@@ -7,6 +7,7 @@
 #include <isa_availability.h>
 #include <list>
 #include <random>
+#include <string>
 #include <vector>
 
 using namespace std;
@@ -69,6 +70,244 @@ void test_reverse_copy(mt19937_64& gen) {
     }
 }
 
+template <class FwdIt, class T>
+inline FwdIt last_known_good_find(FwdIt first, const FwdIt last, const T& val) {
+    for (; first != last; ++first) {
+        if (*first == val) {
+            break;
+        }
+    }
+
+    return first;
+}
+
+template <class FwdIt, class T>
+inline ptrdiff_t last_known_good_count(FwdIt first, const FwdIt last, const T& val) {
+    ptrdiff_t result = 0;
+    for (; first != last; ++first) {
+        if (*first == val) {
+            ++result;
+        }
+    }
+
+    return result;
+}
+
+template <class T>
+void test_case_find_count(const vector<T>& input, const T val) {
+    // also test unaligned input
+    for (size_t offset = 0; offset < 2 && offset <= input.size(); ++offset) {
+        const auto first         = input.begin() + static_cast<ptrdiff_t>(offset);
+        const auto last          = input.end();
+        const auto expectedFind  = last_known_good_find(first, last, val);
+        const auto expectedCount = last_known_good_count(first, last, val);
+        assert(find(first, last, val) == expectedFind);
+        assert(count(first, last, val) == expectedCount);
+#ifdef __cpp_lib_concepts
+        assert(ranges::find(first, last, val) == expectedFind);
+        assert(ranges::count(first, last, val) == expectedCount);
+#endif // __cpp_lib_concepts
+    }
+}
+
+template <class T>
+void test_find_count(mt19937_64& gen) {
+    vector<T> input;
+    input.reserve(dataCount);
+    test_case_find_count(input, T{0});
+    for (size_t attempts = 0; attempts < dataCount; ++attempts) {
+        input.push_back(static_cast<T>(gen() % 64));
+        test_case_find_count(input, static_cast<T>(gen() % 72)); // sometimes searches for values that are never present
+    }
+
+    // values using all of the bits of T, including the sign bit
+    input.assign(dataCount, static_cast<T>(-1));
+    test_case_find_count(input, static_cast<T>(-1));
+    input.back() = static_cast<T>(-2);
+    test_case_find_count(input, static_cast<T>(-2));
+}
+
+template <class FwdIt>
+inline FwdIt last_known_good_min_element(FwdIt first, const FwdIt last) {
+    FwdIt result = first;
+    for (; first != last; ++first) {
+        if (*first < *result) {
+            result = first;
+        }
+    }
+
+    return result;
+}
+
+template <class FwdIt>
+inline FwdIt last_known_good_max_element(FwdIt first, const FwdIt last) {
+    FwdIt result = first;
+    for (; first != last; ++first) {
+        if (*result < *first) {
+            result = first;
+        }
+    }
+
+    return result;
+}
+
+template <class FwdIt>
+inline FwdIt last_known_good_last_max_element(FwdIt first, const FwdIt last) {
+    FwdIt result = first;
+    for (; first != last; ++first) {
+        if (!(*first < *result)) {
+            result = first;
+        }
+    }
+
+    return result;
+}
+
+template <class T>
+void test_case_min_max_element(const vector<T>& input) {
+    const auto first          = input.begin();
+    const auto last           = input.end();
+    const auto expectedMin    = last_known_good_min_element(first, last);
+    const auto expectedMax    = last_known_good_max_element(first, last);
+    const auto expectedMinmax = make_pair(expectedMin, last_known_good_last_max_element(first, last));
+    assert(min_element(first, last) == expectedMin);
+    assert(max_element(first, last) == expectedMax);
+    assert(minmax_element(first, last) == expectedMinmax);
+#ifdef __cpp_lib_concepts
+    assert(ranges::min_element(input) == expectedMin);
+    assert(ranges::max_element(input) == expectedMax);
+    const auto actualMinmax = ranges::minmax_element(input);
+    assert(actualMinmax.min == expectedMinmax.first);
+    assert(actualMinmax.max == expectedMinmax.second);
+#endif // __cpp_lib_concepts
+}
+
+template <class T>
+void test_min_max_element(mt19937_64& gen) {
+    vector<T> input;
+    input.reserve(dataCount);
+    test_case_min_max_element(input);
+    for (size_t attempts = 0; attempts < dataCount; ++attempts) {
+        if (attempts % 2 == 0) {
+            input.push_back(static_cast<T>(gen())); // intentionally narrows
+        } else {
+            input.push_back(static_cast<T>(gen() % 16)); // frequent ties
+        }
+
+        test_case_min_max_element(input);
+    }
+}
+
+template <class T>
+void test_min_max_element_floating() {
+    // +0.0 and -0.0 are equivalent, so the first of either is the minimum and the last of either is the maximum
+    vector<T> input(dataCount, T{1});
+    input[dataCount / 3]     = T{0};
+    input[dataCount / 3 + 7] = -T{0};
+    input[dataCount / 2]     = T{2};
+    input[dataCount / 2 + 1] = T{2};
+    test_case_min_max_element(input);
+    assert(min_element(input.begin(), input.end()) == input.begin() + dataCount / 3);
+    assert(minmax_element(input.begin(), input.end()).second == input.begin() + (dataCount / 2 + 1));
+
+    input[dataCount / 3]     = -T{0};
+    input[dataCount / 3 + 7] = T{0};
+    test_case_min_max_element(input);
+    assert(min_element(input.begin(), input.end()) == input.begin() + dataCount / 3);
+}
+
+template <class Elem>
+size_t last_known_good_find_first_of(const basic_string<Elem>& haystack, const basic_string<Elem>& needle, size_t pos) {
+    for (; pos < haystack.size(); ++pos) {
+        if (needle.find(haystack[pos]) != basic_string<Elem>::npos) {
+            return pos;
+        }
+    }
+
+    return basic_string<Elem>::npos;
+}
+
+template <class Elem>
+size_t last_known_good_find_last_of(const basic_string<Elem>& haystack, const basic_string<Elem>& needle, size_t pos) {
+    for (size_t idx = (min)(pos, haystack.size()); idx != 0; --idx) {
+        if (needle.find(haystack[idx - 1]) != basic_string<Elem>::npos) {
+            return idx - 1;
+        }
+    }
+
+    return basic_string<Elem>::npos;
+}
+
+template <class Elem>
+void test_case_string_find_of(const basic_string<Elem>& haystack, const basic_string<Elem>& needle) {
+    const size_t middle = haystack.size() / 2;
+    assert(haystack.find_first_of(needle) == last_known_good_find_first_of(haystack, needle, 0));
+    assert(haystack.find_first_of(needle, middle) == last_known_good_find_first_of(haystack, needle, middle));
+    assert(haystack.find_last_of(needle) == last_known_good_find_last_of(haystack, needle, haystack.size()));
+    assert(haystack.find_last_of(needle, middle) == last_known_good_find_last_of(haystack, needle, middle + 1));
+}
+
+template <class Elem>
+void test_string_find_of(mt19937_64& gen) {
+    basic_string<Elem> haystack;
+    basic_string<Elem> needle;
+    haystack.reserve(dataCount);
+    for (size_t attempts = 0; attempts < dataCount; ++attempts) {
+        haystack.push_back(static_cast<Elem>('a' + gen() % 32));
+        needle.clear();
+        const size_t needleSize = static_cast<size_t>(gen() % 20); // also needles too long for the vector algorithm
+        for (size_t idx = 0; idx != needleSize; ++idx) {
+            needle.push_back(static_cast<Elem>('a' + 16 + gen() % 32)); // half of these never occur in the haystack
+        }
+
+        test_case_string_find_of(haystack, needle);
+    }
+}
+
+template <class Elem>
+size_t last_known_good_search(const basic_string<Elem>& haystack, const basic_string<Elem>& needle) {
+    for (size_t pos = 0; pos + needle.size() <= haystack.size(); ++pos) {
+        if (equal(needle.begin(), needle.end(), haystack.begin() + static_cast<ptrdiff_t>(pos))) {
+            return pos;
+        }
+    }
+
+    return basic_string<Elem>::npos;
+}
+
+template <class Elem>
+void test_case_search(const basic_string<Elem>& haystack, const basic_string<Elem>& needle) {
+    const size_t expected = last_known_good_search(haystack, needle);
+    assert(haystack.find(needle) == expected);
+    const auto found = search(haystack.begin(), haystack.end(), needle.begin(), needle.end());
+    if (expected == basic_string<Elem>::npos) {
+        assert(found == haystack.end());
+    } else {
+        assert(found == haystack.begin() + static_cast<ptrdiff_t>(expected));
+    }
+}
+
+template <class Elem>
+void test_search(mt19937_64& gen) {
+    // mostly spaces, so that the first element of the needle occurs all over the haystack
+    basic_string<Elem> haystack;
+    basic_string<Elem> needle;
+    haystack.reserve(dataCount);
+    for (size_t attempts = 0; attempts < dataCount; ++attempts) {
+        haystack.push_back(static_cast<Elem>(gen() % 8 == 0 ? 'x' : ' '));
+        needle.assign(static_cast<size_t>(gen() % 8), static_cast<Elem>(' '));
+        if (!needle.empty() && gen() % 2 == 0) {
+            needle.back() = static_cast<Elem>('x');
+        }
+
+        test_case_search(haystack, needle);
+        if (attempts % 16 == 0) { // also a needle that is known to occur
+            const size_t start = static_cast<size_t>(gen() % haystack.size());
+            test_case_search(haystack, haystack.substr(start, static_cast<size_t>(gen() % 40)));
+        }
+    }
+}
+
 template <class FwdIt1, class FwdIt2>
 inline FwdIt2 last_known_good_swap_ranges(FwdIt1 first1, const FwdIt1 last1, FwdIt2 dest) {
     for (; first1 != last1; ++first1, ++dest) {
@@ -133,6 +372,41 @@ void test_vector_algorithms() {
     test_reverse_copy<double>(gen);
     test_reverse_copy<long double>(gen);
 
+    test_find_count<char>(gen);
+    test_find_count<signed char>(gen);
+    test_find_count<unsigned char>(gen);
+    test_find_count<short>(gen);
+    test_find_count<unsigned short>(gen);
+    test_find_count<int>(gen);
+    test_find_count<unsigned int>(gen);
+    test_find_count<long long>(gen);
+    test_find_count<unsigned long long>(gen);
+
+    test_min_max_element<char>(gen);
+    test_min_max_element<signed char>(gen);
+    test_min_max_element<unsigned char>(gen);
+    test_min_max_element<short>(gen);
+    test_min_max_element<unsigned short>(gen);
+    test_min_max_element<int>(gen);
+    test_min_max_element<unsigned int>(gen);
+    test_min_max_element<long long>(gen);
+    test_min_max_element<unsigned long long>(gen);
+    test_min_max_element<float>(gen);
+    test_min_max_element<double>(gen);
+    test_min_max_element<long double>(gen);
+    test_min_max_element_floating<float>();
+    test_min_max_element_floating<double>();
+
+    test_string_find_of<char>(gen);
+    test_string_find_of<wchar_t>(gen);
+    test_string_find_of<char16_t>(gen);
+    test_string_find_of<char32_t>(gen);
+
+    test_search<char>(gen);
+    test_search<wchar_t>(gen);
+    test_search<char16_t>(gen);
+    test_search<char32_t>(gen);
+
     test_swap_ranges<char>(gen);
     test_swap_ranges<short>(gen);
     test_swap_ranges<int>(gen);